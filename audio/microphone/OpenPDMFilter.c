@@ -29,285 +29,897 @@
 
 /* Includes ------------------------------------------------------------------*/
 
+#include <string.h>
 #include "OpenPDMFilter.h"
+#if defined(USE_LUT) && defined(__AVX2__)
+#include <immintrin.h>
+#define FILTER_LANES
+#elif defined(USE_LUT) && defined(__ARM_FEATURE_MVE)
+#include <arm_mve.h>
+#define FILTER_LANES
+#endif
 
 
 /* Variables -----------------------------------------------------------------*/
 
-uint32_t div_const = 0;
-int64_t sub_const = 0;
-uint32_t sinc[DECIMATION_MAX * SINCN];
-uint32_t sinc1[DECIMATION_MAX];
-uint32_t sinc2[DECIMATION_MAX * 2];
-uint32_t coef[SINCN][DECIMATION_MAX];
+#if PDM_FILTER_LUT_ROWS > 0xFFFF
+#error PDM_FILTER_LUT_ROWS must fit in TPDMFilter_Table.LutRow
+#endif
+
+static TPDMFilter_Table tables[PDM_FILTER_TABLES];
 #ifdef USE_LUT
-int32_t lut[256][DECIMATION_MAX / 8][SINCN];
+/* the vector kernels gather 32 bits, which reads past a 16 bit last entry */
+static struct {
+  TPDMFilter_LutEntry Entry[PDM_FILTER_LUT_ROWS * 256];
+  TPDMFilter_LutEntry Pad[2];
+} lut;
 #endif
 
 
 /* Functions -----------------------------------------------------------------*/
 
+/*
+ * The order partial sums of one sinc sample, gathered in one pass over its
+ * bytes.
+ */
 #ifdef USE_LUT
-int32_t filter_table_mono_64(uint8_t *data, uint8_t sincn)
-{
-  return (int32_t)
-    lut[data[0]][0][sincn] +
-    lut[data[1]][1][sincn] +
-    lut[data[2]][2][sincn] +
-    lut[data[3]][3][sincn] +
-    lut[data[4]][4][sincn] +
-    lut[data[5]][5][sincn] +
-    lut[data[6]][6][sincn] +
-    lut[data[7]][7][sincn];
-}
-int32_t filter_table_stereo_64(uint8_t *data, uint8_t sincn)
-{
-  return (int32_t)
-    lut[data[0]][0][sincn] +
-    lut[data[2]][1][sincn] +
-    lut[data[4]][2][sincn] +
-    lut[data[6]][3][sincn] +
-    lut[data[8]][4][sincn] +
-    lut[data[10]][5][sincn] +
-    lut[data[12]][6][sincn] +
-    lut[data[14]][7][sincn];
-}
-int32_t filter_table_mono_128(uint8_t *data, uint8_t sincn)
-{
-  return (int32_t)
-    lut[data[0]][0][sincn] +
-    lut[data[1]][1][sincn] +
-    lut[data[2]][2][sincn] +
-    lut[data[3]][3][sincn] +
-    lut[data[4]][4][sincn] +
-    lut[data[5]][5][sincn] +
-    lut[data[6]][6][sincn] +
-    lut[data[7]][7][sincn] +
-    lut[data[8]][8][sincn] +
-    lut[data[9]][9][sincn] +
-    lut[data[10]][10][sincn] +
-    lut[data[11]][11][sincn] +
-    lut[data[12]][12][sincn] +
-    lut[data[13]][13][sincn] +
-    lut[data[14]][14][sincn] +
-    lut[data[15]][15][sincn];
-}
-int32_t filter_table_stereo_128(uint8_t *data, uint8_t sincn)
-{
-  return (int32_t)
-    lut[data[0]][0][sincn] +
-    lut[data[2]][1][sincn] +
-    lut[data[4]][2][sincn] +
-    lut[data[6]][3][sincn] +
-    lut[data[8]][4][sincn] +
-    lut[data[10]][5][sincn] +
-    lut[data[12]][6][sincn] +
-    lut[data[14]][7][sincn] +
-    lut[data[16]][8][sincn] +
-    lut[data[18]][9][sincn] +
-    lut[data[20]][10][sincn] +
-    lut[data[22]][11][sincn] +
-    lut[data[24]][12][sincn] +
-    lut[data[26]][13][sincn] +
-    lut[data[28]][14][sincn] +
-    lut[data[30]][15][sincn];
-}
-int32_t (* filter_tables_64[2]) (uint8_t *data, uint8_t sincn) = {filter_table_mono_64, filter_table_stereo_64};
-int32_t (* filter_tables_128[2]) (uint8_t *data, uint8_t sincn) = {filter_table_mono_128, filter_table_stereo_128};
+static inline void filter_table(const uint8_t *data, uint8_t channels, uint8_t bytes, uint8_t order,
+                                const TPDMFilter_Table *table, int32_t Z[SINCN_MAX])
+{
+  const TPDMFilter_LutEntry *lut = table->Lut;
+  const TPDMFilter_LutEntry *entry;
+  int32_t Z0 = 0, Z1 = 0, Z2 = 0, Z3 = 0, Z4 = 0;
+  uint8_t d;
+
+  for (d = 0; d < bytes; d++, data += channels, lut += order) {
+    entry = &lut[*data * bytes * order];
+    Z0 += entry[0];
+    Z1 += entry[1];
+    Z2 += entry[2];
+    if (order > 3)
+      Z3 += entry[3];
+    if (order > 4)
+      Z4 += entry[4];
+  }
+
+  Z[0] = Z0;
+  Z[1] = Z1;
+  Z[2] = Z2;
+  Z[3] = Z3;
+  Z[4] = Z4;
+}
 #else
-int32_t filter_table(uint8_t *data, uint8_t sincn, TPDMFilter_InitStruct *param)
-{
-  uint8_t c, i;
-  uint16_t data_index = 0;
-  uint32_t *coef_p = &coef[sincn][0];
-  int32_t F = 0;
-  uint8_t decimation = param->Decimation;
-  uint8_t channels = param->In_MicChannels;
-
-  for (i = 0; i < decimation; i += 8) {
-    c = data[data_index];
-    F += ((c >> 7)       ) * coef_p[i    ] +
-         ((c >> 6) & 0x01) * coef_p[i + 1] +
-         ((c >> 5) & 0x01) * coef_p[i + 2] +
-         ((c >> 4) & 0x01) * coef_p[i + 3] +
-         ((c >> 3) & 0x01) * coef_p[i + 4] +
-         ((c >> 2) & 0x01) * coef_p[i + 5] +
-         ((c >> 1) & 0x01) * coef_p[i + 6] +
-         ((c     ) & 0x01) * coef_p[i + 7];
-    data_index += channels;
+static inline void filter_table(const uint8_t *data, uint8_t channels, uint8_t bytes, uint8_t order,
+                                const TPDMFilter_Table *table, int32_t Z[SINCN_MAX])
+{
+  const uint32_t *coef_p;
+  uint8_t c, d, s;
+
+  for (s = 0; s < order; s++)
+    Z[s] = 0;
+
+  for (d = 0; d < bytes; d++) {
+    c = data[d * channels];
+    for (s = 0; s < order; s++) {
+      coef_p = &table->Coef[s][d * 8];
+      Z[s] += ((c >> 7)       ) * coef_p[0] +
+              ((c >> 6) & 0x01) * coef_p[1] +
+              ((c >> 5) & 0x01) * coef_p[2] +
+              ((c >> 4) & 0x01) * coef_p[3] +
+              ((c >> 3) & 0x01) * coef_p[4] +
+              ((c >> 2) & 0x01) * coef_p[5] +
+              ((c >> 1) & 0x01) * coef_p[6] +
+              ((c     ) & 0x01) * coef_p[7];
+    }
   }
-  return F;
 }
 #endif
 
-void convolve(uint32_t Signal[/* SignalLen */], unsigned short SignalLen,
-              uint32_t Kernel[/* KernelLen */], unsigned short KernelLen,
-              uint32_t Result[/* SignalLen + KernelLen - 1 */])
+/*
+ * Sinc^order kernel, a unit impulse at index 1 run order times through a
+ * boxcar of length decimation (running sum), so that the kernel is framed by
+ * zeros. Written in place, rows of Coef apart.
+ */
+static void build_coef(TPDMFilter_Table *table, uint8_t decimation, uint8_t order)
 {
-  uint16_t n;
-
-  for (n = 0; n < SignalLen + KernelLen - 1; n++)
-  {
-    unsigned short kmin, kmax, k;
-    
-    Result[n] = 0;
-    
-    kmin = (n >= KernelLen - 1) ? n - (KernelLen - 1) : 0;
-    kmax = (n < SignalLen - 1) ? n : SignalLen - 1;
-    
-    for (k = kmin; k <= kmax; k++) {
-      Result[n] += Signal[k] * Kernel[n - k];
-    }
+  uint32_t *k = &table->Coef[0][0];
+  uint16_t len = decimation * order;
+  uint16_t n, s;
+
+  memset(k, 0, len * sizeof(uint32_t));
+  k[1] = 1;
+  for (s = 0; s < order; s++) {
+    for (n = 1; n < len; n++)
+      k[n] += k[n - 1];
+    for (n = len - 1; n >= decimation; n--)
+      k[n] -= k[n - decimation];
   }
+
+  for (s = order - 1; s > 0; s--)
+    memmove(&table->Coef[s][0], &k[s * decimation], decimation * sizeof(uint32_t));
 }
 
-void Open_PDM_Filter_Init(TPDMFilter_InitStruct *Param)
+static uint8_t build_table(TPDMFilter_Table *table, uint8_t decimation, uint8_t order)
 {
   uint16_t i, j;
   int64_t sum = 0;
 
-  uint8_t decimation = Param->Decimation;
-
-  for (i = 0; i < SINCN; i++) {
-    Param->Coef[i] = 0;
-    Param->bit[i] = 0;
-  }
-  for (i = 0; i < decimation; i++) {
-    sinc1[i] = 1;
-  }
-
-  Param->OldOut = Param->OldIn = Param->OldZ = 0;
-  Param->LP_ALFA = (Param->LP_HZ != 0 ? (uint16_t) (Param->LP_HZ * 256 / (Param->LP_HZ + Param->Fs / (2 * 3.14159f))) : 0);
-  Param->HP_ALFA = (Param->HP_HZ != 0 ? (uint16_t) (Param->Fs * 256 / (2 * 3.14159f * Param->HP_HZ + Param->Fs)) : 0);
-
-  Param->FilterLen = decimation * SINCN;       
-  sinc[0] = 0;
-  sinc[decimation * SINCN - 1] = 0;      
-  convolve(sinc1, decimation, sinc1, decimation, sinc2);
-  convolve(sinc2, decimation * 2 - 1, sinc1, decimation, &sinc[1]);     
-  for(j = 0; j < SINCN; j++) {
+  build_coef(table, decimation, order);
+  for(j = 0; j < order; j++) {
     for (i = 0; i < decimation; i++) {
-      coef[j][i] = sinc[j * decimation + i];
-      sum += sinc[j * decimation + i];
+      sum += table->Coef[j][i];
     }
   }
-
-  sub_const = sum >> 1;
-  div_const = sub_const * Param->MaxVolume / 32768 / FILTER_GAIN;
-  div_const = (div_const == 0 ? 1 : div_const);
+  table->SubConst = sum >> 1;
 
 #ifdef USE_LUT
   /* Look-Up Table. */
   uint16_t c, d, s;
-  for (s = 0; s < SINCN; s++)
+  uint32_t entry;
+  uint16_t bytes = decimation / 8;
+  TPDMFilter_LutEntry *entries = &lut.Entry[table->LutRow * 256];
+  for (s = 0; s < order; s++)
   {
-    uint32_t *coef_p = &coef[s][0];
-    for (c = 0; c < 256; c++)
-      for (d = 0; d < decimation / 8; d++)
-        lut[c][d][s] = ((c >> 7)       ) * coef_p[d * 8    ] +
-                       ((c >> 6) & 0x01) * coef_p[d * 8 + 1] +
-                       ((c >> 5) & 0x01) * coef_p[d * 8 + 2] +
-                       ((c >> 4) & 0x01) * coef_p[d * 8 + 3] +
-                       ((c >> 3) & 0x01) * coef_p[d * 8 + 4] +
-                       ((c >> 2) & 0x01) * coef_p[d * 8 + 5] +
-                       ((c >> 1) & 0x01) * coef_p[d * 8 + 6] +
-                       ((c     ) & 0x01) * coef_p[d * 8 + 7];
+    uint32_t *coef_p = &table->Coef[s][0];
+    for (d = 0; d < bytes; d++)
+      for (c = 0; c < 256; c++) {
+        entry = ((c >> 7)       ) * coef_p[d * 8    ] +
+                ((c >> 6) & 0x01) * coef_p[d * 8 + 1] +
+                ((c >> 5) & 0x01) * coef_p[d * 8 + 2] +
+                ((c >> 4) & 0x01) * coef_p[d * 8 + 3] +
+                ((c >> 3) & 0x01) * coef_p[d * 8 + 4] +
+                ((c >> 2) & 0x01) * coef_p[d * 8 + 5] +
+                ((c >> 1) & 0x01) * coef_p[d * 8 + 6] +
+                ((c     ) & 0x01) * coef_p[d * 8 + 7];
+#ifdef PDM_FILTER_LUT_16BIT
+        if (entry > 0xFFFF)
+          return OPEN_PDM_FILTER_ERROR;
+#endif
+        entries[(c * bytes + d) * order + s] = (TPDMFilter_LutEntry) entry;
+      }
   }
+  table->Lut = entries;
 #endif
+
+  table->Order = order;
+  table->Decimation = decimation;
+  return OPEN_PDM_FILTER_OK;
 }
 
-void Open_PDM_Filter_64(uint8_t* data, uint16_t* dataOut, uint16_t volume, TPDMFilter_InitStruct *Param)
+#ifdef USE_LUT
+static inline uint16_t lut_rows(const TPDMFilter_Table *table)
 {
-  uint8_t i, data_out_index;
-  uint8_t channels = Param->In_MicChannels;
-  uint8_t data_inc = ((DECIMATION_MAX >> 4) * channels);
-  int64_t Z, Z0, Z1, Z2;
-  int64_t OldOut, OldIn, OldZ;
+  return table->Order * (table->Decimation / 8);
+}
+
+/*
+ * First fit of a run of Look-Up Table rows, skipping the rows of the tables
+ * in use. The unused tables whose rows are taken are dropped.
+ */
+static uint8_t get_lut_rows(uint16_t rows, uint16_t *first)
+{
+  uint32_t start, end;
+  uint8_t i;
+
+  for (start = 0; start + rows <= PDM_FILTER_LUT_ROWS; ) {
+    end = start + rows;
+    for (i = 0; i < PDM_FILTER_TABLES; i++) {
+      if (tables[i].RefCount > 0 &&
+          tables[i].LutRow < end &&
+          tables[i].LutRow + lut_rows(&tables[i]) > start) {
+        start = tables[i].LutRow + lut_rows(&tables[i]);
+        break;
+      }
+    }
+    if (i == PDM_FILTER_TABLES) {
+      for (i = 0; i < PDM_FILTER_TABLES; i++)
+        if (tables[i].RefCount == 0 &&
+            tables[i].LutRow < end &&
+            tables[i].LutRow + lut_rows(&tables[i]) > start)
+          tables[i].Decimation = 0;
+      *first = (uint16_t) start;
+      return OPEN_PDM_FILTER_OK;
+    }
+  }
 
-  OldOut = Param->OldOut;
-  OldIn = Param->OldIn;
-  OldZ = Param->OldZ;
+  return OPEN_PDM_FILTER_ERROR;
+}
+#endif
 
+/*
+ * A table already built for this decimation and order is shared, otherwise an
+ * unused one is rebuilt. Tables in use are never written.
+ */
+static TPDMFilter_Table *get_table(uint8_t decimation, uint8_t order)
+{
+  TPDMFilter_Table *table = NULL;
+  uint8_t i;
+
+  for (i = 0; i < PDM_FILTER_TABLES; i++) {
+    if (tables[i].Decimation == decimation && tables[i].Order == order) {
+      table = &tables[i];
+      break;
+    }
+    if (table == NULL && tables[i].RefCount == 0)
+      table = &tables[i];
+  }
+
+  if (table == NULL || table->RefCount == 0xFF)
+    return NULL;
+
+  if (table->Decimation != decimation || table->Order != order) {
+    table->Decimation = 0;
 #ifdef USE_LUT
-  uint8_t j = channels - 1;
+    if (get_lut_rows(order * (decimation / 8), &table->LutRow) != OPEN_PDM_FILTER_OK)
+      return NULL;
 #endif
+    if (build_table(table, decimation, order) != OPEN_PDM_FILTER_OK)
+      return NULL;
+  }
+  table->RefCount++;
+
+  return table;
+}
+
+/*
+ * cos(2 pi x), Taylor series over a quarter period, so that Init does not need
+ * libm. Good to a few 1e-7.
+ */
+static float cos_turns(float x)
+{
+  float t, c;
+  uint8_t neg = 0;
+
+  if (x < 0)
+    x = -x;
+  x -= (float) (uint32_t) x;
+  if (x > 0.5f)
+    x = 1.0f - x;
+  if (x > 0.25f) {
+    x = 0.5f - x;
+    neg = 1;
+  }
+
+  t = 2 * 3.14159265f * x;
+  t *= t;
+  c = 1 - t / 2 * (1 - t / 12 * (1 - t / 30 * (1 - t / 56 * (1 - t / 90 * (1 - t / 132)))));
+
+  return neg ? -c : c;
+}
+
+/*
+ * Gain of the sinc filter at f, f in units of its output rate.
+ */
+static float sinc_gain(float f, uint8_t decimation, uint8_t order)
+{
+  float r, g = 1.0f;
+  uint8_t s;
+
+  if (f == 0)
+    return 1.0f;
+
+  /* sin(pi f) / (D sin(pi f / D)) */
+  r = cos_turns(f / 2 - 0.25f) / (decimation * cos_turns(f / (2 * decimation) - 0.25f));
+  for (s = 0; s < order; s++)
+    g *= r;
+
+  return g < 0 ? -g : g;
+}
+
+/* Integration steps over the pass band of the compensating FIR. */
+#define FIR_GRID 256
+
+/*
+ * Window method design of the decimate by 2 FIR, at the sinc output rate: the
+ * ideal low-pass cut at a quarter of that rate, flat for the half-band (its
+ * even taps are zero) or with the inverse sinc gain in its pass band, times a
+ * Blackman window. The taps are symmetric, coef[k] is the Q15 tap k away
+ * from the centre, the centre tap taking the rounding so that the DC gain is
+ * exactly 1.
+ */
+static uint8_t fir_design(int16_t *coef, uint8_t mode, uint8_t taps, uint8_t decimation, uint8_t order)
+{
+  uint8_t centre = taps / 2;
+  uint16_t k, n;
+  float h, f;
+  int32_t q, sum = 0;
+
+  for (k = centre; k > 0; k--) {
+    if (mode == PDM_FILTER_FIR_HALFBAND) {
+      /* sin(pi k / 2) / (pi k) */
+      h = (k & 1) ? cos_turns(k / 4.0f - 0.25f) / (3.14159265f * k) : 0;
+    } else {
+      /* 2 * integral over [0, 1/4] of cos(2 pi f k) / sinc gain */
+      h = 0;
+      for (n = 0; n < FIR_GRID; n++) {
+        f = (n + 0.5f) / (4 * FIR_GRID);
+        h += cos_turns(f * k) / sinc_gain(f, decimation, order);
+      }
+      h /= 2 * FIR_GRID;
+    }
+
+    h *= 0.42f + 0.5f * cos_turns((float) k / (taps + 1)) + 0.08f * cos_turns(2.0f * k / (taps + 1));
+
+    q = (int32_t) (h * 32768 + (h < 0 ? -0.5f : 0.5f));
+    if (q > 32767 || q < -32768)
+      return OPEN_PDM_FILTER_ERROR;
+    coef[k] = (int16_t) q;
+    sum += 2 * q;
+  }
+
+  q = 32768 - sum;
+  if (q > 32767 || q < -32768)
+    return OPEN_PDM_FILTER_ERROR;
+  coef[0] = (int16_t) q;
+
+  return OPEN_PDM_FILTER_OK;
+}
+
+/*
+ * The table held by Param, Table is only trusted if it is one of ours.
+ */
+static TPDMFilter_Table *held_table(const TPDMFilter_InitStruct *Param)
+{
+  uint8_t i;
 
-  for (i = 0, data_out_index = 0; i < Param->Fs / 1000; i++, data_out_index += channels) {
+  for (i = 0; i < PDM_FILTER_TABLES; i++)
+    if (Param->Table == &tables[i] && tables[i].RefCount > 0)
+      return &tables[i];
+
+  return NULL;
+}
+
+/*
+ * Whether Param is one of the holders waiting for table to be rebuilt for
+ * its next decimation and order.
+ */
+static uint8_t table_waiting(const TPDMFilter_InitStruct *Param, const TPDMFilter_Table *table)
+{
+  return table->Waiting > 0 &&
+         table->NextDecimation == Param->TableDecimation &&
+         table->NextOrder == Param->TableOrder &&
+         (table->Decimation != Param->TableDecimation || table->Order != Param->TableOrder);
+}
+
+/*
+ * Rebuild a shared table for its next decimation and order, once all its
+ * holders wait for it. On failure the table matches none of them.
+ */
+static uint8_t switch_table(TPDMFilter_Table *table)
+{
+  uint8_t refs = table->RefCount;
+  uint8_t status = OPEN_PDM_FILTER_OK;
+
+  /* its own rows are free for the new ones */
+  table->RefCount = 0;
+  table->Decimation = 0;
+  table->Waiting = 0;
 #ifdef USE_LUT
-    Z0 = filter_tables_64[j](data, 0);
-    Z1 = filter_tables_64[j](data, 1);
-    Z2 = filter_tables_64[j](data, 2);
-#else
-    Z0 = filter_table(data, 0, Param);
-    Z1 = filter_table(data, 1, Param);
-    Z2 = filter_table(data, 2, Param);
+  status = get_lut_rows(table->NextOrder * (table->NextDecimation / 8), &table->LutRow);
 #endif
+  if (status == OPEN_PDM_FILTER_OK)
+    status = build_table(table, table->NextDecimation, table->NextOrder);
+  table->RefCount = refs;
+
+  return status;
+}
 
-    Z = Param->Coef[1] + Z2 - sub_const;
-    Param->Coef[1] = Param->Coef[0] + Z1;
-    Param->Coef[0] = Z0;
+void Open_PDM_Filter_DeInit(TPDMFilter_InitStruct *Param)
+{
+  TPDMFilter_Table *table = held_table(Param);
+
+  if (table != NULL) {
+    if (table_waiting(Param, table))
+      table->Waiting--;
+    table->RefCount--;
+    /* the holders left may all be waiting */
+    if (table->Waiting > 0 && table->Waiting == table->RefCount)
+      switch_table(table);
+  }
 
-    OldOut = (Param->HP_ALFA * (OldOut + Z - OldIn)) >> 8;
-    OldIn = Z;
-    OldZ = ((256 - Param->LP_ALFA) * OldZ + Param->LP_ALFA * OldOut) >> 8;
+  Param->Table = NULL;
+}
 
-    Z = OldZ * volume;
-    Z = RoundDiv(Z, div_const);
-    Z = SaturaLH(Z, -32700, 32700);
+uint8_t Open_PDM_Filter_Init(TPDMFilter_InitStruct *Param)
+{
+  uint16_t i;
+  uint64_t gain = 1;
+  const TPDMFilter_Table *table;
+  int16_t fir_coef[PDM_FILTER_FIR_TAPS_MAX / 2 + 1];
+
+  uint8_t decimation = Param->Decimation;
+  uint8_t order = (Param->SincOrder != 0 ? Param->SincOrder : SINCN);
+  uint8_t taps = 0;
+  uint8_t waiting;
+  TPDMFilter_Table *old = held_table(Param);
+
+  if (Param->FirMode != PDM_FILTER_FIR_NONE) {
+    taps = (Param->FirTaps != 0 ? Param->FirTaps : PDM_FILTER_FIR_TAPS_MAX);
+    if (Param->FirMode > PDM_FILTER_FIR_COMPENSATED ||
+        taps < 3 || taps > PDM_FILTER_FIR_TAPS_MAX || (taps & 1) == 0 ||
+        (Param->FirMode == PDM_FILTER_FIR_HALFBAND && (taps & 3) != 3) ||
+        (decimation & 1) != 0)
+      return OPEN_PDM_FILTER_ERROR;
+    decimation /= 2;
+  }
 
-    dataOut[data_out_index] = Z;
-    data += data_inc;
+  if (decimation == 0 || decimation > DECIMATION_MAX || (decimation & 0x07) != 0 ||
+      order < SINCN || order > SINCN_MAX)
+    return OPEN_PDM_FILTER_ERROR;
+
+  /* sinc sums and samples are kept on 32 bits */
+  for (i = 0; i < order; i++)
+    gain *= decimation;
+  if (gain >= ((uint64_t) 1 << 31))
+    return OPEN_PDM_FILTER_ERROR;
+
+  if (taps != 0 &&
+      fir_design(fir_coef, Param->FirMode, taps, decimation, order) != OPEN_PDM_FILTER_OK)
+    return OPEN_PDM_FILTER_ERROR;
+
+  /*
+   * The new table is taken before the old one is released, so that a failed
+   * Init leaves the instance filtering as before. When no table is free, an
+   * old table that is not shared is released first to be rebuilt, a failure
+   * leaving the instance without table. A shared one is rebuilt once all its
+   * holders have asked for the same decimation and order, and keeps serving
+   * the others until then.
+   */
+  table = get_table(decimation, order);
+  if (table == NULL && old != NULL && old->RefCount == 1) {
+    Open_PDM_Filter_DeInit(Param);
+    table = get_table(decimation, order);
+  } else if (table == NULL && old != NULL) {
+    waiting = old->Waiting - table_waiting(Param, old);
+    if (waiting > 0 && (old->NextDecimation != decimation || old->NextOrder != order))
+      return OPEN_PDM_FILTER_ERROR;
+    old->NextDecimation = decimation;
+    old->NextOrder = order;
+    old->Waiting = waiting + 1;
+    if (old->Waiting == old->RefCount && switch_table(old) != OPEN_PDM_FILTER_OK)
+      return OPEN_PDM_FILTER_ERROR;
+    table = old;
+    old = NULL;
   }
+  if (table == NULL)
+    return OPEN_PDM_FILTER_ERROR;
+  if (old != NULL)
+    Open_PDM_Filter_DeInit(Param);
+
+  for (i = 0; i < SINCN_MAX; i++) {
+    Param->Coef[i] = 0;
+    Param->bit[i] = 0;
+  }
+
+  /* the FIR stage gets the sinc samples scaled up to 2^29, so that its
+   * rounding and the HP and LP filters after it work below the sinc LSB */
+  Param->FirShift = 0;
+  if (taps != 0)
+    while ((gain << (Param->FirShift + 1)) <= ((uint64_t) 1 << 30))
+      Param->FirShift++;
+
+  if (taps != 0)
+    memcpy(Param->FirCoef, fir_coef, sizeof(fir_coef));
+  memset(Param->FirHist, 0, sizeof(Param->FirHist));
+  Param->FirLen = taps;
+  Param->FirPos = 0;
 
-  Param->OldOut = OldOut;
-  Param->OldIn = OldIn;
-  Param->OldZ = OldZ;
+  Param->OldOut = Param->OldIn = Param->OldZ = 0;
+  Param->LP_ALFA = (Param->LP_HZ != 0 ? (uint16_t) (Param->LP_HZ * 256 / (Param->LP_HZ + Param->Fs / (2 * 3.14159f))) : 0);
+  Param->HP_ALFA = (Param->HP_HZ != 0 ? (uint16_t) (Param->Fs * 256 / (2 * 3.14159f * Param->HP_HZ + Param->Fs)) : 0);
+
+  Param->FilterLen = decimation * order;
+
+  /* the SubConst of the table, which may not be rebuilt yet */
+  Param->DivConst = ((int64_t) (gain >> 1) << Param->FirShift) * Param->MaxVolume / 32768 / FILTER_GAIN;
+  Param->DivConst = (Param->DivConst == 0 ? 1 : Param->DivConst);
+
+  Param->Table = table;
+  Param->TableDecimation = decimation;
+  Param->TableOrder = order;
+
+  return OPEN_PDM_FILTER_OK;
 }
 
-void Open_PDM_Filter_128(uint8_t* data, uint16_t* dataOut, uint16_t volume, TPDMFilter_InitStruct *Param)
+/*
+ * Filter state and constants of one channel, kept in locals for a whole block.
+ */
+typedef struct {
+  uint32_t Coef[SINCN_MAX - 1];
+  int64_t OldOut, OldIn, OldZ;
+  int64_t SubConst;
+  uint32_t DivConst;
+  uint16_t HP_ALFA, LP_ALFA;
+} filter_state;
+
+/*
+ * FIR stage of one channel, apart so that filter_state fits a cache line.
+ */
+typedef struct {
+  uint8_t FirLen, FirPos, FirStep, FirShift;
+  const int16_t *FirCoef;
+  int32_t *FirHist;
+} fir_state;
+
+static inline void state_load(filter_state *st, const TPDMFilter_InitStruct *Param)
+{
+  uint8_t s;
+
+  for (s = 0; s < SINCN_MAX - 1; s++)
+    st->Coef[s] = Param->Coef[s];
+  st->OldOut = Param->OldOut;
+  st->OldIn = Param->OldIn;
+  st->OldZ = Param->OldZ;
+  st->SubConst = Param->Table->SubConst;
+  st->DivConst = Param->DivConst;
+  st->HP_ALFA = Param->HP_ALFA;
+  st->LP_ALFA = Param->LP_ALFA;
+}
+
+static inline void state_store(const filter_state *st, TPDMFilter_InitStruct *Param)
+{
+  uint8_t s;
+
+  for (s = 0; s < SINCN_MAX - 1; s++)
+    Param->Coef[s] = st->Coef[s];
+  Param->OldOut = st->OldOut;
+  Param->OldIn = st->OldIn;
+  Param->OldZ = st->OldZ;
+}
+
+/*
+ * Combines the partial sums of the last order sinc samples into one sample,
+ * less its offset.
+ */
+static inline int64_t sinc_sample(filter_state *st, const int32_t Z[SINCN_MAX], uint8_t order)
+{
+  int64_t out;
+  uint8_t s;
+
+  out = (int64_t) st->Coef[order - 2] + Z[order - 1] - st->SubConst;
+  for (s = order - 2; s > 0; s--)
+    st->Coef[s] = st->Coef[s - 1] + Z[s];
+  st->Coef[0] = Z[0];
+
+  return out;
+}
+
+/*
+ * The FIR history is kept twice, FirLen apart, so that the last FirLen samples
+ * are always contiguous.
+ */
+static inline void fir_push(fir_state *st, int32_t x)
+{
+  st->FirHist[st->FirPos] = x;
+  st->FirHist[st->FirPos + st->FirLen] = x;
+  if (++st->FirPos == st->FirLen)
+    st->FirPos = 0;
+}
+
+/*
+ * FIR output over the last FirLen samples, symmetric taps folded, skipping the
+ * zero taps of a half-band. Samples are below 2^29, so a folded pair fits.
+ */
+static inline int64_t fir_sample(const fir_state *st)
+{
+  const int32_t *x = &st->FirHist[st->FirPos + st->FirLen / 2];
+  const int16_t *h = st->FirCoef;
+  int64_t acc = (int64_t) h[0] * x[0];
+  uint8_t k;
+
+  for (k = 1; k <= st->FirLen / 2; k += st->FirStep)
+    acc += (int64_t) h[k] * (x[-k] + x[k]);
+
+  return (acc + (1 << 14)) >> 15;
+}
+
+/*
+ * One sinc sample, less its offset. Constant orders let the compiler keep the
+ * partial sums in registers.
+ */
+static inline int64_t sinc_step(filter_state *st, const uint8_t *data, uint8_t channels, uint8_t bytes,
+                                uint8_t order, const TPDMFilter_Table *table)
+{
+  int32_t Zs[SINCN_MAX];
+
+  if (order == 3) {
+    filter_table(data, channels, bytes, 3, table, Zs);
+    return sinc_sample(st, Zs, 3);
+  } else if (order == 4) {
+    filter_table(data, channels, bytes, 4, table, Zs);
+    return sinc_sample(st, Zs, 4);
+  }
+  filter_table(data, channels, bytes, 5, table, Zs);
+  return sinc_sample(st, Zs, 5);
+}
+
+/*
+ * HP and LP filters and scales one sample.
+ */
+static inline uint16_t filter_sample(filter_state *st, int64_t Z, uint16_t volume)
+{
+  st->OldOut = (st->HP_ALFA * (st->OldOut + Z - st->OldIn)) >> 8;
+  st->OldIn = Z;
+  st->OldZ = ((256 - st->LP_ALFA) * st->OldZ + st->LP_ALFA * st->OldOut) >> 8;
+
+  Z = st->OldZ * volume;
+  Z = RoundDiv(Z, st->DivConst);
+  Z = SaturaLH(Z, -32700, 32700);
+
+  return Z;
+}
+
+/*
+ * Whether Param has a table for the bytes per channel and output sample of the
+ * call, which it has not after a failed Init or while waiting for a rebuild.
+ */
+static inline uint8_t table_matches(const TPDMFilter_InitStruct *Param, uint8_t bytes)
+{
+  const TPDMFilter_Table *table = Param->Table;
+
+  return table != NULL &&
+         table->Decimation == Param->TableDecimation &&
+         table->Order == Param->TableOrder &&
+         bytes == (table->Decimation / 8) * (Param->FirLen != 0 ? 2 : 1);
+}
+
+/*
+ * bytes is the number of bytes per channel and output sample.
+ */
+static void filter_block(uint8_t* data, uint16_t* dataOut, uint16_t samples, uint16_t volume,
+                         TPDMFilter_InitStruct *Param, uint8_t bytes)
 {
-  uint8_t i, data_out_index;
+  uint16_t i;
   uint8_t channels = Param->In_MicChannels;
-  uint8_t data_inc = ((DECIMATION_MAX >> 3) * channels);
-  int64_t Z, Z0, Z1, Z2;
-  int64_t OldOut, OldIn, OldZ;
+  uint16_t data_inc = bytes * channels;
+  const TPDMFilter_Table *table = Param->Table;
+  uint8_t order, sinc_bytes;
+  filter_state st;
+  fir_state fir;
+  int32_t Zs[SINCN_MAX];
+  int64_t Z;
+
+  if (!table_matches(Param, bytes))
+    return;
+
+  order = table->Order;
+  sinc_bytes = table->Decimation / 8;
+  state_load(&st, Param);
+
+  if (order == SINCN && Param->FirLen == 0) {
+    for (i = 0; i < samples; i++) {
+      /* constant byte counts let the compiler unroll the usual decimations */
+      if (bytes == 64 / 8)
+        filter_table(data, channels, 64 / 8, SINCN, table, Zs);
+      else if (bytes == 128 / 8)
+        filter_table(data, channels, 128 / 8, SINCN, table, Zs);
+      else
+        filter_table(data, channels, bytes, SINCN, table, Zs);
+
+      *dataOut = filter_sample(&st, sinc_sample(&st, Zs, SINCN), volume);
+      dataOut += channels;
+      data += data_inc;
+    }
+  } else {
+    fir.FirLen = Param->FirLen;
+    fir.FirPos = Param->FirPos;
+    fir.FirStep = (Param->FirMode == PDM_FILTER_FIR_HALFBAND ? 2 : 1);
+    fir.FirShift = Param->FirShift;
+    fir.FirCoef = Param->FirCoef;
+    fir.FirHist = Param->FirHist;
+
+    for (i = 0; i < samples; i++) {
+      Z = sinc_step(&st, data, channels, sinc_bytes, order, table);
+
+      /* the FIR stage takes two sinc samples per output sample */
+      if (fir.FirLen != 0) {
+        fir_push(&fir, (int32_t) Z * (1 << fir.FirShift));
+        Z = sinc_step(&st, data + sinc_bytes * channels, channels, sinc_bytes, order, table);
+        fir_push(&fir, (int32_t) Z * (1 << fir.FirShift));
+        Z = fir_sample(&fir);
+      }
+
+      *dataOut = filter_sample(&st, Z, volume);
+      dataOut += channels;
+      data += data_inc;
+    }
 
-  OldOut = Param->OldOut;
-  OldIn = Param->OldIn;
-  OldZ = Param->OldZ;
+    Param->FirPos = fir.FirPos;
+  }
 
-#ifdef USE_LUT
-  uint8_t j = channels - 1;
+  state_store(&st, Param);
+}
+
+#if defined(USE_LUT) && defined(__AVX2__)
+/* 32 bit gathers, a 16 bit entry is the low half of the word read */
+static inline __m256i gather_x8(const TPDMFilter_LutEntry *row, __m256i idx)
+{
+  __m256i v = _mm256_i32gather_epi32((const int *) row, idx, sizeof(TPDMFilter_LutEntry));
+#ifdef PDM_FILTER_LUT_16BIT
+  v = _mm256_and_si256(v, _mm256_set1_epi32(0xFFFF));
 #endif
+  return v;
+}
 
-  for (i = 0, data_out_index = 0; i < Param->Fs / 1000; i++, data_out_index += channels) {
-#ifdef USE_LUT
-    Z0 = filter_tables_128[j](data, 0);
-    Z1 = filter_tables_128[j](data, 1);
-    Z2 = filter_tables_128[j](data, 2);
+static inline __m128i gather_x4(const TPDMFilter_LutEntry *row, __m128i idx)
+{
+  __m128i v = _mm_i32gather_epi32((const int *) row, idx, sizeof(TPDMFilter_LutEntry));
+#ifdef PDM_FILTER_LUT_16BIT
+  v = _mm_and_si128(v, _mm_set1_epi32(0xFFFF));
+#endif
+  return v;
+}
+
+/*
+ * The sinc partial sums of 8 (or 4) adjacent channels, one channel per lane,
+ * gathered at byte value * bytes from the LUT entries of each byte position.
+ */
+static inline void filter_table_x8(const uint8_t *data, uint8_t channels, uint8_t bytes,
+                                   const TPDMFilter_Table *table, int32_t Z[SINCN][PDM_FILTER_CHANNELS_MAX])
+{
+  const __m256i stride = _mm256_set1_epi32(bytes * SINCN);
+  __m256i Z0 = _mm256_setzero_si256(), Z1 = Z0, Z2 = Z0;
+  __m256i idx;
+  uint8_t d;
+
+  for (d = 0; d < bytes; d++, data += channels) {
+    idx = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i *) data));
+    idx = _mm256_mullo_epi32(idx, stride);
+    Z0 = _mm256_add_epi32(Z0, gather_x8(&table->Lut[d * SINCN], idx));
+    Z1 = _mm256_add_epi32(Z1, gather_x8(&table->Lut[d * SINCN + 1], idx));
+    Z2 = _mm256_add_epi32(Z2, gather_x8(&table->Lut[d * SINCN + 2], idx));
+  }
+
+  _mm256_storeu_si256((__m256i *) Z[0], Z0);
+  _mm256_storeu_si256((__m256i *) Z[1], Z1);
+  _mm256_storeu_si256((__m256i *) Z[2], Z2);
+}
+
+static inline void filter_table_x4(const uint8_t *data, uint8_t channels, uint8_t bytes,
+                                   const TPDMFilter_Table *table, int32_t Z[SINCN][PDM_FILTER_CHANNELS_MAX])
+{
+  const __m128i stride = _mm_set1_epi32(bytes * SINCN);
+  __m128i Z0 = _mm_setzero_si128(), Z1 = Z0, Z2 = Z0;
+  __m128i idx;
+  int32_t c;
+  uint8_t d;
+
+  for (d = 0; d < bytes; d++, data += channels) {
+    memcpy(&c, data, sizeof(c));
+    idx = _mm_cvtepu8_epi32(_mm_cvtsi32_si128(c));
+    idx = _mm_mullo_epi32(idx, stride);
+    Z0 = _mm_add_epi32(Z0, gather_x4(&table->Lut[d * SINCN], idx));
+    Z1 = _mm_add_epi32(Z1, gather_x4(&table->Lut[d * SINCN + 1], idx));
+    Z2 = _mm_add_epi32(Z2, gather_x4(&table->Lut[d * SINCN + 2], idx));
+  }
+
+  _mm_storeu_si128((__m128i *) Z[0], Z0);
+  _mm_storeu_si128((__m128i *) Z[1], Z1);
+  _mm_storeu_si128((__m128i *) Z[2], Z2);
+}
+#elif defined(USE_LUT) && defined(__ARM_FEATURE_MVE)
+/* Helium gathers, offsets in entries, a 16 bit entry is zero extended */
+static inline int32x4_t gather_x4(const TPDMFilter_LutEntry *row, uint32x4_t idx)
+{
+#ifdef PDM_FILTER_LUT_16BIT
+  return vreinterpretq_s32_u32(vldrhq_gather_shifted_offset_u32(row, idx));
 #else
-    Z0 = filter_table(data, 0, Param);
-    Z1 = filter_table(data, 1, Param);
-    Z2 = filter_table(data, 2, Param);
+  return vldrwq_gather_shifted_offset_s32(row, idx);
+#endif
+}
+
+/*
+ * The sinc partial sums of the 4 adjacent channels from lane, one channel per
+ * vector lane, as the AVX2 kernels. Vectors are 4 lanes wide, 8 channels take
+ * two passes.
+ */
+static inline void filter_table_lanes(const uint8_t *data, uint8_t channels, uint8_t bytes,
+                                      const TPDMFilter_Table *table, int32_t Z[SINCN][PDM_FILTER_CHANNELS_MAX],
+                                      uint8_t lane)
+{
+  int32x4_t Z0 = vdupq_n_s32(0), Z1 = Z0, Z2 = Z0;
+  uint32x4_t idx;
+  uint8_t d;
+
+  for (d = 0, data += lane; d < bytes; d++, data += channels) {
+    idx = vmulq_n_u32(vldrbq_u32(data), (uint32_t) bytes * SINCN);
+    Z0 = vaddq_s32(Z0, gather_x4(&table->Lut[d * SINCN], idx));
+    Z1 = vaddq_s32(Z1, gather_x4(&table->Lut[d * SINCN + 1], idx));
+    Z2 = vaddq_s32(Z2, gather_x4(&table->Lut[d * SINCN + 2], idx));
+  }
+
+  vst1q_s32(&Z[0][lane], Z0);
+  vst1q_s32(&Z[1][lane], Z1);
+  vst1q_s32(&Z[2][lane], Z2);
+}
+
+static inline void filter_table_x8(const uint8_t *data, uint8_t channels, uint8_t bytes,
+                                   const TPDMFilter_Table *table, int32_t Z[SINCN][PDM_FILTER_CHANNELS_MAX])
+{
+  filter_table_lanes(data, channels, bytes, table, Z, 0);
+  filter_table_lanes(data, channels, bytes, table, Z, 4);
+}
+
+static inline void filter_table_x4(const uint8_t *data, uint8_t channels, uint8_t bytes,
+                                   const TPDMFilter_Table *table, int32_t Z[SINCN][PDM_FILTER_CHANNELS_MAX])
+{
+  filter_table_lanes(data, channels, bytes, table, Z, 0);
+}
 #endif
 
-    Z = Param->Coef[1] + Z2 - sub_const;
-    Param->Coef[1] = Param->Coef[0] + Z1;
-    Param->Coef[0] = Z0;
+void Open_PDM_Filter_64(uint8_t* data, uint16_t* dataOut, uint16_t volume, TPDMFilter_InitStruct *Param)
+{
+  filter_block(data, dataOut, Param->Fs / 1000, volume, Param, 64 / 8);
+}
 
-    OldOut = (Param->HP_ALFA * (OldOut + Z - OldIn)) >> 8;
-    OldIn = Z;
-    OldZ = ((256 - Param->LP_ALFA) * OldZ + Param->LP_ALFA * OldOut) >> 8;
+void Open_PDM_Filter_128(uint8_t* data, uint16_t* dataOut, uint16_t volume, TPDMFilter_InitStruct *Param)
+{
+  filter_block(data, dataOut, Param->Fs / 1000, volume, Param, 128 / 8);
+}
 
-    Z = OldZ * volume;
-    Z = RoundDiv(Z, div_const);
-    Z = SaturaLH(Z, -32700, 32700);
+void Open_PDM_Filter_Block(uint8_t* data, uint16_t* dataOut, uint16_t samples, uint16_t volume, TPDMFilter_InitStruct *Param)
+{
+  filter_block(data, dataOut, samples, volume, Param, Param->Decimation / 8);
+}
+
+void Open_PDM_Filter_Block_Multi(uint8_t* data, uint16_t* dataOut, uint16_t samples, uint16_t volume, TPDMFilter_InitStruct *Param)
+{
+  uint8_t ch;
+  uint8_t channels = Param->In_MicChannels;
+  uint8_t bytes = Param->Decimation / 8;
+
+#ifdef FILTER_LANES
+  uint16_t i;
+  uint16_t data_inc = bytes * channels;
+  const TPDMFilter_Table *table = Param->Table;
+  filter_state st[PDM_FILTER_CHANNELS_MAX];
+  int32_t Z[SINCN][PDM_FILTER_CHANNELS_MAX];
+  int32_t Zs[SINCN_MAX];
+
+  /* all the channels must have the table of the first one */
+  for (ch = 0; ch < channels; ch++)
+    if (!table_matches(&Param[ch], bytes) || Param[ch].Table != table || Param[ch].FirLen != 0)
+      break;
+
+  if ((channels == 4 || channels == 8) && ch == channels && table->Order == SINCN) {
+    for (ch = 0; ch < channels; ch++)
+      state_load(&st[ch], &Param[ch]);
+
+    for (i = 0; i < samples; i++) {
+      if (channels == 8) {
+        if (bytes == 64 / 8)
+          filter_table_x8(data, 8, 64 / 8, table, Z);
+        else if (bytes == 128 / 8)
+          filter_table_x8(data, 8, 128 / 8, table, Z);
+        else
+          filter_table_x8(data, 8, bytes, table, Z);
+      } else {
+        if (bytes == 64 / 8)
+          filter_table_x4(data, 4, 64 / 8, table, Z);
+        else if (bytes == 128 / 8)
+          filter_table_x4(data, 4, 128 / 8, table, Z);
+        else
+          filter_table_x4(data, 4, bytes, table, Z);
+      }
+
+      for (ch = 0; ch < channels; ch++) {
+        Zs[0] = Z[0][ch];
+        Zs[1] = Z[1][ch];
+        Zs[2] = Z[2][ch];
+        dataOut[ch] = filter_sample(&st[ch], sinc_sample(&st[ch], Zs, SINCN), volume);
+      }
+
+      dataOut += channels;
+      data += data_inc;
+    }
 
-    dataOut[data_out_index] = Z;
-    data += data_inc;
+    for (ch = 0; ch < channels; ch++)
+      state_store(&st[ch], &Param[ch]);
+    return;
   }
+#endif
 
-  Param->OldOut = OldOut;
-  Param->OldIn = OldIn;
-  Param->OldZ = OldZ;
+  /* a scalar pass per channel keeps its state in registers */
+  for (ch = 0; ch < channels; ch++)
+    filter_block(data + ch, dataOut + ch, samples, volume, &Param[ch], bytes);
 }
@@ -51,10 +51,57 @@
  */
 #define USE_LUT
 
+/*
+ * Enable to store the Look-Up Table on 16 bits, halving its size. Init refuses
+ * the decimations whose entries do not fit (above 104 at order 3, 16 at order
+ * 4 and 8 at order 5).
+ */
+/* #define PDM_FILTER_LUT_16BIT */
+
+/* Default and highest order of the sinc filter, see SincOrder. */
 #define SINCN            3
+#define SINCN_MAX        5
 #define DECIMATION_MAX 128
 #define FILTER_GAIN     16
 
+/*
+ * Highest number of taps of the decimate by 2 FIR stage, see FirMode. Each
+ * filter keeps 2 * PDM_FILTER_FIR_TAPS_MAX samples of history.
+ */
+#ifndef PDM_FILTER_FIR_TAPS_MAX
+#define PDM_FILTER_FIR_TAPS_MAX 31
+#endif
+
+#define PDM_FILTER_FIR_NONE         0
+#define PDM_FILTER_FIR_HALFBAND     1
+#define PDM_FILTER_FIR_COMPENSATED  2
+
+/*
+ * Number of decimation tables that can be in use at the same time. Filters
+ * with the same sinc decimation and order share one read-only table, so this
+ * is the number of different ones running concurrently. When no table is
+ * free, the instances sharing a table can still be Init'ed one after the other
+ * for another decimation: the table is rebuilt when the last of them is.
+ */
+#ifndef PDM_FILTER_TABLES
+#define PDM_FILTER_TABLES 1
+#endif
+
+/*
+ * Look-Up Table rows shared by the tables in use, a table takes one row of 256
+ * entries per sinc order and byte position, Order * Decimation / 8 rows. 24
+ * rows are enough for a single 64x decimation at order SINCN.
+ */
+#ifndef PDM_FILTER_LUT_ROWS
+#define PDM_FILTER_LUT_ROWS (PDM_FILTER_TABLES * SINCN * DECIMATION_MAX / 8)
+#endif
+
+/* Channels filtered together by Open_PDM_Filter_Block_Multi(). */
+#define PDM_FILTER_CHANNELS_MAX 8
+
+#define OPEN_PDM_FILTER_OK     0
+#define OPEN_PDM_FILTER_ERROR  1
+
 #define HTONS(A) ((((uint16_t)(A) & 0xff00) >> 8) | \
                  (((uint16_t)(A) & 0x00ff) << 8))
 #define RoundDiv(a, b)    (((a)>0)?(((a)+(b)/2)/(b)):(((a)-(b)/2)/(b)))
@@ -63,6 +110,35 @@
 
 /* Types ---------------------------------------------------------------------*/
 
+#ifdef PDM_FILTER_LUT_16BIT
+typedef uint16_t TPDMFilter_LutEntry;
+#else
+typedef int32_t TPDMFilter_LutEntry;
+#endif
+
+/*
+ * Sinc filter coefficients for one decimation and order, built by
+ * Open_PDM_Filter_Init() and only read while filtering. The Look-Up Table only
+ * has the Decimation / 8 byte positions of a sample, stored byte value first:
+ * Lut[(c * D / 8 + d) * Order] holds the Order entries of byte value c at
+ * position d, so the positions of the byte values seen in a stream share
+ * cache lines.
+ */
+typedef struct {
+  uint8_t Decimation;
+  uint8_t Order;
+  uint8_t RefCount;
+  uint8_t NextDecimation;
+  uint8_t NextOrder;
+  uint8_t Waiting;
+  uint16_t LutRow;
+  int64_t SubConst;
+  uint32_t Coef[SINCN_MAX][DECIMATION_MAX];
+#ifdef USE_LUT
+  const TPDMFilter_LutEntry *Lut;
+#endif
+} TPDMFilter_Table;
+
 typedef struct {
   /* Public */
   float LP_HZ;
@@ -72,23 +148,70 @@ typedef struct {
   uint8_t Out_MicChannels;
   uint8_t Decimation;
   uint8_t MaxVolume;
+  uint8_t SincOrder;
+  uint8_t FirMode;
+  uint8_t FirTaps;
   /* Private */
-  uint32_t Coef[SINCN];
+  uint32_t Coef[SINCN_MAX];
   uint16_t FilterLen;
   int64_t OldOut, OldIn, OldZ;
   uint16_t LP_ALFA;
   uint16_t HP_ALFA;
   uint16_t bit[5];
   uint16_t byte;
+  uint32_t DivConst;
+  const TPDMFilter_Table *Table;
+  uint8_t TableDecimation;
+  uint8_t TableOrder;
+  uint8_t FirLen;
+  uint8_t FirPos;
+  uint8_t FirShift;
+  int16_t FirCoef[PDM_FILTER_FIR_TAPS_MAX / 2 + 1];
+  int32_t FirHist[2 * PDM_FILTER_FIR_TAPS_MAX];
 } TPDMFilter_InitStruct;
 
 
 /* Exported functions ------------------------------------------------------- */
 
-void Open_PDM_Filter_Init(TPDMFilter_InitStruct *init_struct);
+/*
+ * Decimation is the overall decimation. SincOrder, SINCN to SINCN_MAX or 0 for
+ * SINCN, is the order of the sinc filter, whose decimation to the power
+ * SincOrder must stay below 2^31 (72x at order 5). With FirMode set, the sinc
+ * filter decimates by Decimation / 2 and a FIR of FirTaps taps (0 for
+ * PDM_FILTER_FIR_TAPS_MAX, odd) by 2: a half-band, FirTaps of the form 4k + 3,
+ * or a low-pass compensating the sinc droop. Init computes the FIR
+ * coefficients, filtering stays integer.
+ *
+ * Init and DeInit update the shared tables and must not run concurrently with
+ * each other. Table must be NULL, or set by a previous Init, when Init is
+ * called. A failed Init keeps the previous table of the instance, unless it was
+ * the only user of a table that had to be rebuilt. The filter functions write
+ * no output for an instance without table, or waiting for its shared table to
+ * be rebuilt (see PDM_FILTER_TABLES), or when called for another decimation.
+ * Filtering only reads the tables and the instance, so instances can be
+ * filtered concurrently.
+ */
+uint8_t Open_PDM_Filter_Init(TPDMFilter_InitStruct *init_struct);
+void Open_PDM_Filter_DeInit(TPDMFilter_InitStruct *init_struct);
 void Open_PDM_Filter_64(uint8_t* data, uint16_t* data_out, uint16_t mic_gain, TPDMFilter_InitStruct *init_struct);
 void Open_PDM_Filter_128(uint8_t* data, uint16_t* data_out, uint16_t mic_gain, TPDMFilter_InitStruct *init_struct);
 
+/*
+ * Filter and decimate by init_struct->Decimation into samples output samples,
+ * any number of them, with the same data layout as Open_PDM_Filter_64/128.
+ */
+void Open_PDM_Filter_Block(uint8_t* data, uint16_t* data_out, uint16_t samples, uint16_t mic_gain, TPDMFilter_InitStruct *init_struct);
+
+/*
+ * Same as Open_PDM_Filter_Block() for all the In_MicChannels interleaved
+ * channels, init_struct pointing to one instance per channel, all with the
+ * same Decimation, SincOrder, FirMode, FirTaps and In_MicChannels. When built
+ * for AVX2 or Helium (MVE), the lookups of 4 or 8 channels at order SINCN
+ * without FIR stage are done together, otherwise the channels are filtered one
+ * after the other.
+ */
+void Open_PDM_Filter_Block_Multi(uint8_t* data, uint16_t* data_out, uint16_t samples, uint16_t mic_gain, TPDMFilter_InitStruct *init_struct);
+
 #ifdef __cplusplus
 }
 #endif
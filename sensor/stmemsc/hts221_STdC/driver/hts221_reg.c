@@ -1019,6 +1019,112 @@ int32_t hts221_temp_adc_point_1_get(const stmdev_ctx_t *ctx, float_t *val)
   return ret;
 }
 
+/**
+  * @brief  Read the whole calibration block (0x30 - 0x3F) with a single
+  *         burst and precompute the integer interpolation coefficients
+  *         used by hts221_from_lsb_to_rh_x100() and
+  *         hts221_from_lsb_to_celsius_x100().[get]
+  *
+  * @param  ctx     read / write interface definitions
+  * @param  val     calibration coefficients
+  * @retval         interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t hts221_calibration_get(const stmdev_ctx_t *ctx, hts221_calib_t *val)
+{
+  uint8_t buff[16];
+  uint8_t msb;
+  int32_t rh_0;
+  int32_t rh_1;
+  int32_t deg_0;
+  int32_t deg_1;
+  int32_t lsb_1;
+  int32_t ret;
+
+  ret = hts221_read_reg(ctx, HTS221_H0_RH_X2, buff, 16);
+
+  if (ret == 0)
+  {
+    msb = buff[HTS221_T1_T0_MSB - HTS221_H0_RH_X2];
+
+    /* humidity points are stored as rH x 2, temperature ones as degC x 8 */
+    rh_0 = (int32_t)buff[HTS221_H0_RH_X2 - HTS221_H0_RH_X2] * 50;
+    rh_1 = (int32_t)buff[HTS221_H1_RH_X2 - HTS221_H0_RH_X2] * 50;
+    deg_0 = ((((int32_t)msb & 0x03) * 256) +
+             (int32_t)buff[HTS221_T0_DEGC_X8 - HTS221_H0_RH_X2]) * 25 / 2;
+    deg_1 = (((((int32_t)msb >> 2) & 0x03) * 256) +
+             (int32_t)buff[HTS221_T1_DEGC_X8 - HTS221_H0_RH_X2]) * 25 / 2;
+
+    val->hum_lsb_0 = (int16_t)((buff[HTS221_H0_T0_OUT_H - HTS221_H0_RH_X2] * 256) +
+                               buff[HTS221_H0_T0_OUT_L - HTS221_H0_RH_X2]);
+    lsb_1 = (int16_t)((buff[HTS221_H1_T0_OUT_H - HTS221_H0_RH_X2] * 256) +
+                      buff[HTS221_H1_T0_OUT_L - HTS221_H0_RH_X2]);
+    val->hum_rh_0 = rh_0;
+    val->hum_slope = 0;
+    if (lsb_1 != val->hum_lsb_0)
+    {
+      val->hum_slope = (int32_t)(((int64_t)(rh_1 - rh_0) * 65536) /
+                                 (lsb_1 - val->hum_lsb_0));
+    }
+
+    val->temp_lsb_0 = (int16_t)((buff[HTS221_T0_OUT_H - HTS221_H0_RH_X2] * 256) +
+                                buff[HTS221_T0_OUT_L - HTS221_H0_RH_X2]);
+    lsb_1 = (int16_t)((buff[HTS221_T1_OUT_H - HTS221_H0_RH_X2] * 256) +
+                      buff[HTS221_T1_OUT_L - HTS221_H0_RH_X2]);
+    val->temp_deg_0 = deg_0;
+    val->temp_slope = 0;
+    if (lsb_1 != val->temp_lsb_0)
+    {
+      val->temp_slope = (int32_t)(((int64_t)(deg_1 - deg_0) * 65536) /
+                                  (lsb_1 - val->temp_lsb_0));
+    }
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Convert raw humidity to rH x 100 using the integer calibration
+  *         coefficients; result is clamped to 0 - 100 %rH.
+  *
+  * @param  cal     calibration coefficients from hts221_calibration_get
+  * @param  lsb     raw humidity sample
+  * @retval         relative humidity in 0.01 %rH
+  *
+  */
+int32_t hts221_from_lsb_to_rh_x100(const hts221_calib_t *cal, int16_t lsb)
+{
+  int64_t delta = (int64_t)cal->hum_slope * (lsb - cal->hum_lsb_0);
+  int32_t rh = cal->hum_rh_0 + (int32_t)((delta + 32768) >> 16);
+
+  if (rh < 0)
+  {
+    rh = 0;
+  }
+  if (rh > 10000)
+  {
+    rh = 10000;
+  }
+
+  return rh;
+}
+
+/**
+  * @brief  Convert raw temperature to degC x 100 using the integer
+  *         calibration coefficients.
+  *
+  * @param  cal     calibration coefficients from hts221_calibration_get
+  * @param  lsb     raw temperature sample
+  * @retval         temperature in 0.01 degC
+  *
+  */
+int32_t hts221_from_lsb_to_celsius_x100(const hts221_calib_t *cal, int16_t lsb)
+{
+  int64_t delta = (int64_t)cal->temp_slope * (lsb - cal->temp_lsb_0);
+
+  return cal->temp_deg_0 + (int32_t)((delta + 32768) >> 16);
+}
+
 /**
   * @}
   *
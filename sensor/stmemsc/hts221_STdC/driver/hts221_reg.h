@@ -445,6 +445,20 @@ int32_t hts221_hum_adc_point_1_get(const stmdev_ctx_t *ctx, float_t *val);
 int32_t hts221_temp_adc_point_0_get(const stmdev_ctx_t *ctx, float_t *val);
 int32_t hts221_temp_adc_point_1_get(const stmdev_ctx_t *ctx, float_t *val);
 
+typedef struct
+{
+  int32_t hum_rh_0;    /* first humidity point [0.01 %rH] */
+  int32_t hum_slope;   /* [0.01 %rH / LSB] in Q16 */
+  int32_t temp_deg_0;  /* first temperature point [0.01 degC] */
+  int32_t temp_slope;  /* [0.01 degC / LSB] in Q16 */
+  int16_t hum_lsb_0;   /* raw humidity at first point */
+  int16_t temp_lsb_0;  /* raw temperature at first point */
+} hts221_calib_t;
+int32_t hts221_calibration_get(const stmdev_ctx_t *ctx, hts221_calib_t *val);
+
+int32_t hts221_from_lsb_to_rh_x100(const hts221_calib_t *cal, int16_t lsb);
+int32_t hts221_from_lsb_to_celsius_x100(const hts221_calib_t *cal, int16_t lsb);
+
 /**
   * @}
   *
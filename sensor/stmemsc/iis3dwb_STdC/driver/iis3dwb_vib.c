@@ -0,0 +1,425 @@
+/**
+  ******************************************************************************
+  * @file    iis3dwb_vib.c
+  * @brief   IIS3DWB streaming vibration analysis: per-axis RMS, peak, crest
+  *          factor and band energies computed on windowed frames drained
+  *          from the FIFO with iis3dwb_fifo_out_multi_raw_get().
+  *          The spectrum is computed with a Q15 real FFT, either by the
+  *          CMSIS-DSP arm_rfft_q15() (define IIS3DWB_VIB_CMSIS_DSP) or by
+  *          the portable kernel below, both scaled by 1 / N.
+  ******************************************************************************
+  * @attention
+  *
+  * SPDX-License-Identifier: BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+#include "iis3dwb_vib.h"
+
+/**
+  * @defgroup    IIS3DWB_Vibration
+  * @brief       This file provides a streaming vibration analysis stage
+  *              for predictive maintenance built on the iis3dwb FIFO.
+  * @{
+  *
+  */
+
+#define IIS3DWB_VIB_HALF_LEN   (IIS3DWB_VIB_FFT_LEN / 2U)
+#define IIS3DWB_VIB_2PI        6.28318531f
+
+/**
+  * @defgroup    IIS3DWB_Vibration_Private_functions
+  * @brief       Q15 FFT kernels and per-axis feature extraction.
+  * @{
+  *
+  */
+
+static int16_t iis3dwb_vib_q15(float_t val)
+{
+  float_t q = floorf((val * 32768.0f) + 0.5f);
+
+  if (q > 32767.0f)
+  {
+    q = 32767.0f;
+  }
+  if (q < -32768.0f)
+  {
+    q = -32768.0f;
+  }
+
+  return (int16_t)q;
+}
+
+#ifdef IIS3DWB_VIB_CMSIS_DSP
+
+static void iis3dwb_vib_rfft(iis3dwb_vib_t *vib, int16_t *x)
+{
+  arm_rfft_q15(&vib->rfft, x, vib->spec);
+}
+
+/* |X[k] / N|^2 */
+static uint32_t iis3dwb_vib_bin_power(const iis3dwb_vib_t *vib,
+                                      const int16_t *x, uint16_t k)
+{
+  int32_t re = vib->spec[2U * k];
+  int32_t im = vib->spec[(2U * k) + 1U];
+
+  (void)x;
+
+  return (uint32_t)(((int64_t)re * re) + ((int64_t)im * im));
+}
+
+#else
+
+/*
+ * Radix-2 DIT complex FFT on the N / 2 points z[n] = x[2n] + j x[2n + 1],
+ * in place. Each stage halves its output (overall 1 / (N / 2) scaling), so
+ * no stage can overflow as long as the input magnitude is below 1.
+ */
+static void iis3dwb_vib_rfft(iis3dwb_vib_t *vib, int16_t *z)
+{
+  uint16_t i, j, k, len, half, step, a, b;
+  int32_t tr, ti, ar, ai, br, bi, c, s;
+  int16_t tmp;
+
+  j = 0U;
+  for (i = 0U; i < (IIS3DWB_VIB_HALF_LEN - 1U); i++)
+  {
+    if (i < j)
+    {
+      tmp = z[2U * i];
+      z[2U * i] = z[2U * j];
+      z[2U * j] = tmp;
+      tmp = z[(2U * i) + 1U];
+      z[(2U * i) + 1U] = z[(2U * j) + 1U];
+      z[(2U * j) + 1U] = tmp;
+    }
+    k = IIS3DWB_VIB_HALF_LEN >> 1;
+    while (k <= j)
+    {
+      j -= k;
+      k >>= 1;
+    }
+    j += k;
+  }
+
+  for (len = 2U; len <= IIS3DWB_VIB_HALF_LEN; len <<= 1)
+  {
+    half = len >> 1;
+    step = IIS3DWB_VIB_FFT_LEN / len;
+    for (i = 0U; i < IIS3DWB_VIB_HALF_LEN; i += len)
+    {
+      for (k = 0U; k < half; k++)
+      {
+        c = vib->cos_tab[k * step];
+        s = vib->sin_tab[k * step];
+        a = (uint16_t)(2U * (i + k));
+        b = (uint16_t)(a + (2U * half));
+        ar = z[a];
+        ai = z[a + 1U];
+        br = z[b];
+        bi = z[b + 1U];
+        tr = ((c * br) + (s * bi)) >> 15;
+        ti = ((c * bi) - (s * br)) >> 15;
+        z[a] = (int16_t)((ar + tr) >> 1);
+        z[a + 1U] = (int16_t)((ai + ti) >> 1);
+        z[b] = (int16_t)((ar - tr) >> 1);
+        z[b + 1U] = (int16_t)((ai - ti) >> 1);
+      }
+    }
+  }
+}
+
+/*
+ * |X[k] / N|^2 from the half-length complex spectrum Z (scaled by 2 / N):
+ * X[k] = Fe[k] + W^k Fo[k], Fe = (Z[k] + Z*[M - k]) / 2,
+ * Fo = (Z[k] - Z*[M - k]) / 2j. xr, xi below hold 4 X[k] / N.
+ */
+static uint32_t iis3dwb_vib_bin_power(const iis3dwb_vib_t *vib,
+                                      const int16_t *z, uint16_t k)
+{
+  int32_t zr, zi, cr, ci, fr, fi, xr, xi;
+
+  if ((k == 0U) || (k == IIS3DWB_VIB_HALF_LEN))
+  {
+    xr = (k == 0U) ? (z[0] + z[1]) : (z[0] - z[1]);
+    xr *= 2;
+    xi = 0;
+  }
+  else
+  {
+    zr = z[2U * k];
+    zi = z[(2U * k) + 1U];
+    cr = z[2U * (IIS3DWB_VIB_HALF_LEN - k)];
+    ci = -(int32_t)z[(2U * (IIS3DWB_VIB_HALF_LEN - k)) + 1U];
+    fr = zi - ci;
+    fi = cr - zr;
+    xr = (zr + cr) + (((vib->cos_tab[k] * fr) + (vib->sin_tab[k] * fi)) >> 15);
+    xi = (zi + ci) + (((vib->cos_tab[k] * fi) - (vib->sin_tab[k] * fr)) >> 15);
+  }
+
+  return (uint32_t)((((int64_t)xr * xr) + ((int64_t)xi * xi)) >> 4);
+}
+
+#endif /* IIS3DWB_VIB_CMSIS_DSP */
+
+static void iis3dwb_vib_axis(iis3dwb_vib_t *vib, int16_t *x,
+                             iis3dwb_vib_axis_t *val)
+{
+  uint64_t energy;
+  uint32_t pwr;
+  int64_t sq = 0;
+  int32_t sum = 0;
+  int32_t peak = 0;
+  int32_t mean, ac;
+  int16_t shift = 0;
+  uint16_t i, k;
+  uint8_t b;
+  float_t scale;
+
+  for (i = 0U; i < IIS3DWB_VIB_FFT_LEN; i++)
+  {
+    sum += x[i];
+  }
+  mean = sum / (int32_t)IIS3DWB_VIB_FFT_LEN;
+
+  for (i = 0U; i < IIS3DWB_VIB_FFT_LEN; i++)
+  {
+    ac = x[i] - mean;
+    sq += (int64_t)ac * ac;
+    if (ac < 0)
+    {
+      ac = -ac;
+    }
+    if (ac > peak)
+    {
+      peak = ac;
+    }
+  }
+
+  /* block floating point: bring the AC peak to 14 bits before the FFT */
+  if (peak > 0)
+  {
+    while ((peak << (shift + 1)) <= 16383)
+    {
+      shift++;
+    }
+    if (shift == 0)
+    {
+      while ((peak >> -shift) > 16383)
+      {
+        shift--;
+      }
+    }
+  }
+
+  for (i = 0U; i < IIS3DWB_VIB_FFT_LEN; i++)
+  {
+    ac = x[i] - mean;
+    ac = (shift >= 0) ? (ac * (1 << shift)) : (ac >> -shift);
+    x[i] = (int16_t)((ac * vib->win[i]) >> 15);
+  }
+
+  iis3dwb_vib_rfft(vib, x);
+
+  val->rms = sqrtf((float_t)sq / (float_t)IIS3DWB_VIB_FFT_LEN) * vib->sens;
+  val->peak = (float_t)peak * vib->sens;
+  val->crest = (val->rms > 0.0f) ? (val->peak / val->rms) : 0.0f;
+
+  /* one-sided spectrum, window power corrected, back to [mg^2] */
+  scale = ldexpf((vib->sens * vib->sens) / vib->win_pwr, -2 * shift);
+  for (b = 0U; b < vib->bands; b++)
+  {
+    energy = 0U;
+    for (k = vib->bin_lo[b]; k <= vib->bin_hi[b]; k++)
+    {
+      pwr = iis3dwb_vib_bin_power(vib, x, k);
+      energy += ((k == 0U) || (k == IIS3DWB_VIB_HALF_LEN)) ? pwr : (2U * (uint64_t)pwr);
+    }
+    val->band[b] = (float_t)energy * scale;
+  }
+}
+
+/**
+  * @}
+  *
+  */
+
+/**
+  * @brief  Initialize the vibration analysis stage.
+  *
+  * @param  vib     analysis state
+  * @param  fs      accelerometer full scale used to convert to mg
+  * @param  band    frequency bands whose energy is reported [Hz]
+  * @param  bands   number of bands (max IIS3DWB_VIB_BANDS_MAX)
+  * @retval         0 -> no Error, -1 -> invalid parameter
+  *
+  */
+int32_t iis3dwb_vib_init(iis3dwb_vib_t *vib, iis3dwb_fs_xl_t fs,
+                         const iis3dwb_vib_band_t *band, uint8_t bands)
+{
+  float_t w, acc = 0.0f;
+  float_t lo, hi;
+  uint16_t k;
+  uint8_t b;
+
+  if (bands > IIS3DWB_VIB_BANDS_MAX)
+  {
+    return -1;
+  }
+
+  switch (fs)
+  {
+    case IIS3DWB_2g:
+      vib->sens = iis3dwb_from_fs2g_to_mg(1);
+      break;
+    case IIS3DWB_4g:
+      vib->sens = iis3dwb_from_fs4g_to_mg(1);
+      break;
+    case IIS3DWB_8g:
+      vib->sens = iis3dwb_from_fs8g_to_mg(1);
+      break;
+    case IIS3DWB_16g:
+      vib->sens = iis3dwb_from_fs16g_to_mg(1);
+      break;
+    default:
+      return -1;
+  }
+
+  for (k = 0U; k < IIS3DWB_VIB_FFT_LEN; k++)
+  {
+    w = 0.5f - (0.5f * cosf((IIS3DWB_VIB_2PI * (float_t)k) /
+                            (float_t)IIS3DWB_VIB_FFT_LEN));
+    vib->win[k] = iis3dwb_vib_q15(w);
+    w = (float_t)vib->win[k] / 32768.0f;
+    acc += w * w;
+  }
+  vib->win_pwr = acc / (float_t)IIS3DWB_VIB_FFT_LEN;
+
+#ifdef IIS3DWB_VIB_CMSIS_DSP
+  if (arm_rfft_init_q15(&vib->rfft, IIS3DWB_VIB_FFT_LEN, 0U, 1U) != ARM_MATH_SUCCESS)
+  {
+    return -1;
+  }
+#else
+  for (k = 0U; k < IIS3DWB_VIB_HALF_LEN; k++)
+  {
+    w = (IIS3DWB_VIB_2PI * (float_t)k) / (float_t)IIS3DWB_VIB_FFT_LEN;
+    vib->cos_tab[k] = iis3dwb_vib_q15(cosf(w));
+    vib->sin_tab[k] = iis3dwb_vib_q15(sinf(w));
+  }
+#endif /* IIS3DWB_VIB_CMSIS_DSP */
+
+  for (b = 0U; b < bands; b++)
+  {
+    lo = ceilf((band[b].f_lo * (float_t)IIS3DWB_VIB_FFT_LEN) / IIS3DWB_VIB_ODR_HZ);
+    hi = floorf((band[b].f_hi * (float_t)IIS3DWB_VIB_FFT_LEN) / IIS3DWB_VIB_ODR_HZ);
+    lo = (lo < 0.0f) ? 0.0f : lo;
+    hi = (hi > (float_t)IIS3DWB_VIB_HALF_LEN) ? (float_t)IIS3DWB_VIB_HALF_LEN : hi;
+
+    if (hi < lo)
+    {
+      /* empty band, reports zero energy */
+      lo = 1.0f;
+      hi = 0.0f;
+    }
+    vib->bin_lo[b] = (uint16_t)lo;
+    vib->bin_hi[b] = (uint16_t)hi;
+  }
+  vib->bands = bands;
+  vib->fill = 0U;
+
+  return 0;
+}
+
+/**
+  * @brief  Append FIFO words to the analysis frame; non accelerometer
+  *         words are skipped. Each time IIS3DWB_VIB_FFT_LEN samples are
+  *         collected the features are computed into val.
+  *
+  * @param  vib     analysis state
+  * @param  fdata   FIFO words, as read by iis3dwb_fifo_out_multi_raw_get
+  * @param  num     number of FIFO words
+  * @param  val     features of the last completed frame
+  * @retval         number of frames completed
+  *
+  */
+uint16_t iis3dwb_vib_feed(iis3dwb_vib_t *vib,
+                          const iis3dwb_fifo_out_raw_t *fdata, uint16_t num,
+                          iis3dwb_vib_features_t *val)
+{
+  uint16_t frames = 0U;
+  uint16_t i;
+  uint8_t a;
+
+  for (i = 0U; i < num; i++)
+  {
+    if ((fdata[i].tag >> 3) != (uint8_t)IIS3DWB_XL_TAG)
+    {
+      continue;
+    }
+
+    for (a = 0U; a < 3U; a++)
+    {
+      vib->buf[a][vib->fill] = (int16_t)fdata[i].data[(2U * a) + 1U];
+      vib->buf[a][vib->fill] = (int16_t)((vib->buf[a][vib->fill] * 256) +
+                                         (int16_t)fdata[i].data[2U * a]);
+    }
+
+    vib->fill++;
+    if (vib->fill == IIS3DWB_VIB_FFT_LEN)
+    {
+      for (a = 0U; a < 3U; a++)
+      {
+        iis3dwb_vib_axis(vib, vib->buf[a], &val->axis[a]);
+      }
+      vib->fill = 0U;
+      frames++;
+    }
+  }
+
+  return frames;
+}
+
+/**
+  * @brief  Drain the whole FIFO, IIS3DWB_VIB_FIFO_CHUNK words per bus
+  *         transaction, into the analysis stage.
+  *
+  * @param  ctx     read / write interface definitions
+  * @param  vib     analysis state
+  * @param  val     features of the last completed frame
+  * @param  frames  number of frames completed
+  * @retval         interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t iis3dwb_vib_fifo_process(const stmdev_ctx_t *ctx, iis3dwb_vib_t *vib,
+                                 iis3dwb_vib_features_t *val,
+                                 uint16_t *frames)
+{
+  iis3dwb_fifo_out_raw_t fdata[IIS3DWB_VIB_FIFO_CHUNK];
+  uint16_t level;
+  uint16_t num;
+  int32_t ret;
+
+  *frames = 0U;
+  ret = iis3dwb_fifo_data_level_get(ctx, &level);
+
+  while ((ret == 0) && (level > 0U))
+  {
+    num = (level > IIS3DWB_VIB_FIFO_CHUNK) ? IIS3DWB_VIB_FIFO_CHUNK : level;
+    ret = iis3dwb_fifo_out_multi_raw_get(ctx, fdata, num);
+    if (ret == 0)
+    {
+      *frames += iis3dwb_vib_feed(vib, fdata, num, val);
+    }
+    level -= num;
+  }
+
+  return ret;
+}
+
+/**
+  * @}
+  *
+  */
@@ -0,0 +1,123 @@
+/**
+  ******************************************************************************
+  * @file    iis3dwb_vib.h
+  * @brief   This file contains the prototypes of the iis3dwb_vib.c
+  *          vibration analysis stage.
+  ******************************************************************************
+  * @attention
+  *
+  * SPDX-License-Identifier: BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef IIS3DWB_VIB_H
+#define IIS3DWB_VIB_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "iis3dwb_reg.h"
+
+#ifdef IIS3DWB_VIB_CMSIS_DSP
+#include "arm_math.h"
+#endif /* IIS3DWB_VIB_CMSIS_DSP */
+
+/** @addtogroup IIS3DWB_Vibration
+  * @{
+  *
+  */
+
+/** @defgroup  IIS3DWB_Vibration_Configuration
+  * @brief     Samples per analysis frame (FFT length, power of two,
+  *            32 to 4096), maximum number of frequency bands and
+  *            number of FIFO words drained per bus transaction.
+  * @{
+  *
+  */
+
+#ifndef IIS3DWB_VIB_FFT_LEN
+#define IIS3DWB_VIB_FFT_LEN          512U
+#endif /* IIS3DWB_VIB_FFT_LEN */
+
+#ifndef IIS3DWB_VIB_BANDS_MAX
+#define IIS3DWB_VIB_BANDS_MAX        8U
+#endif /* IIS3DWB_VIB_BANDS_MAX */
+
+#ifndef IIS3DWB_VIB_FIFO_CHUNK
+#define IIS3DWB_VIB_FIFO_CHUNK       32U
+#endif /* IIS3DWB_VIB_FIFO_CHUNK */
+
+#if ((IIS3DWB_VIB_FFT_LEN & (IIS3DWB_VIB_FFT_LEN - 1U)) != 0U) || \
+    (IIS3DWB_VIB_FFT_LEN < 32U) || (IIS3DWB_VIB_FFT_LEN > 4096U)
+#error "IIS3DWB_VIB_FFT_LEN must be a power of two in 32 - 4096"
+#endif
+
+/** Output data rate of the accelerometer [Hz] */
+#define IIS3DWB_VIB_ODR_HZ           26667.0f
+
+/**
+  * @}
+  *
+  */
+
+typedef struct
+{
+  float_t f_lo;     /* lower band edge [Hz] */
+  float_t f_hi;     /* upper band edge [Hz] */
+} iis3dwb_vib_band_t;
+
+typedef struct
+{
+  float_t rms;      /* AC (mean removed) RMS [mg] */
+  float_t peak;     /* AC peak [mg] */
+  float_t crest;    /* peak / rms */
+  float_t band[IIS3DWB_VIB_BANDS_MAX]; /* band mean square [mg^2] */
+} iis3dwb_vib_axis_t;
+
+typedef struct
+{
+  iis3dwb_vib_axis_t axis[3];
+} iis3dwb_vib_features_t;
+
+typedef struct
+{
+  int16_t buf[3][IIS3DWB_VIB_FFT_LEN];          /* per-axis samples */
+  int16_t win[IIS3DWB_VIB_FFT_LEN];             /* Hann window, Q15 */
+#ifdef IIS3DWB_VIB_CMSIS_DSP
+  q15_t spec[2U * IIS3DWB_VIB_FFT_LEN];
+  arm_rfft_instance_q15 rfft;
+#else
+  int16_t cos_tab[IIS3DWB_VIB_FFT_LEN / 2U];    /* cos(2 pi k / N), Q15 */
+  int16_t sin_tab[IIS3DWB_VIB_FFT_LEN / 2U];    /* sin(2 pi k / N), Q15 */
+#endif /* IIS3DWB_VIB_CMSIS_DSP */
+  uint16_t bin_lo[IIS3DWB_VIB_BANDS_MAX];
+  uint16_t bin_hi[IIS3DWB_VIB_BANDS_MAX];
+  float_t sens;       /* [mg / LSB] */
+  float_t win_pwr;    /* mean square of the window */
+  uint16_t fill;
+  uint8_t bands;
+} iis3dwb_vib_t;
+
+int32_t iis3dwb_vib_init(iis3dwb_vib_t *vib, iis3dwb_fs_xl_t fs,
+                         const iis3dwb_vib_band_t *band, uint8_t bands);
+uint16_t iis3dwb_vib_feed(iis3dwb_vib_t *vib,
+                          const iis3dwb_fifo_out_raw_t *fdata, uint16_t num,
+                          iis3dwb_vib_features_t *val);
+int32_t iis3dwb_vib_fifo_process(const stmdev_ctx_t *ctx, iis3dwb_vib_t *vib,
+                                 iis3dwb_vib_features_t *val,
+                                 uint16_t *frames);
+
+/**
+  * @}
+  *
+  */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* IIS3DWB_VIB_H */
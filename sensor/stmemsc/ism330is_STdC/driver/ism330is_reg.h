@@ -2776,6 +2776,24 @@ int32_t ism330is_ispu_read_memory(const stmdev_ctx_t *ctx,
                                   ism330is_ispu_memory_type_t mem_sel,
                                   uint16_t mem_addr, uint8_t *mem_data, uint16_t len);
 
+#ifndef ISM330IS_ISPU_VERIFY_CHUNK
+#define ISM330IS_ISPU_VERIFY_CHUNK  256U
+#endif /* ISM330IS_ISPU_VERIFY_CHUNK */
+
+typedef struct
+{
+  ism330is_ispu_memory_type_t mem_sel;
+  uint16_t addr;
+  const uint8_t *data;
+  uint16_t len;
+  uint32_t crc; /* CRC-32 of data, checked on verify */
+} ism330is_ispu_section_t;
+uint32_t ism330is_ispu_crc32(uint32_t crc, const uint8_t *data, uint32_t len);
+int32_t ism330is_ispu_load(const stmdev_ctx_t *ctx,
+                           const ism330is_ispu_section_t *sec, uint16_t num,
+                           uint8_t verify);
+int32_t ism330is_ispu_boot_wait(const stmdev_ctx_t *ctx, uint16_t timeout);
+
 int32_t ism330is_ispu_write_flags(const stmdev_ctx_t *ctx, uint16_t data);
 int32_t ism330is_ispu_read_flags(const stmdev_ctx_t *ctx, uint16_t *data);
 int32_t ism330is_ispu_clear_flags(const stmdev_ctx_t *ctx);
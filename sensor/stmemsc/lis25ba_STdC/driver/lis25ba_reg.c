@@ -395,6 +395,85 @@ int32_t lis25ba_data_get(uint16_t *tdm_stream, lis25ba_bus_mode_t *md,
   return 0;
 }
 
+/**
+  * @brief  Split a TDM buffer holding many frames (e.g. filled by DMA)
+  *         into per-device, per-axis arrays. The slot mapping of each
+  *         device sharing the TDM bus is taken from md[].tdm.mapping.
+  *         Conversion to mg is skipped for the axes whose mg pointer is
+  *         NULL.[get]
+  *
+  * @param  tdm_stream  TDM buffer of frames * slots words.(ptr)
+  * @param  frames      number of TDM frames in tdm_stream
+  * @param  slots       number of 16 bit slots in a TDM frame
+  * @param  md          bus mode of each device.(ptr)
+  * @param  data        output arrays of each device.(ptr)
+  * @param  devs        number of devices on the TDM bus
+  *
+  * @retval             0 -> no Error, -1 -> mapping outside of the frame
+  *
+  */
+int32_t lis25ba_data_multi_get(const uint16_t *tdm_stream, uint16_t frames,
+                               uint8_t slots, lis25ba_bus_mode_t *md,
+                               lis25ba_data_multi_t *data, uint8_t devs)
+{
+  const uint16_t *src;
+  int16_t *x;
+  int16_t *y;
+  int16_t *z;
+  uint32_t f;
+  uint8_t offset;
+  uint8_t d;
+  uint8_t i;
+
+  for (d = 0U; d < devs; d++)
+  {
+    offset = (md[d].tdm.mapping == PROPERTY_DISABLE) ? 0U : 4U;
+    if ((offset + 3U) > slots)
+    {
+      return -1;
+    }
+
+    src = &tdm_stream[offset];
+    x = data[d].raw[0];
+    y = data[d].raw[1];
+    z = data[d].raw[2];
+
+    /* constant stride for the common 8 slots frame lets the compiler
+     * turn the gather into vector loads and permutes */
+    if (slots == 8U)
+    {
+      for (f = 0U; f < frames; f++)
+      {
+        x[f] = (int16_t)src[(8U * f)];
+        y[f] = (int16_t)src[(8U * f) + 1U];
+        z[f] = (int16_t)src[(8U * f) + 2U];
+      }
+    }
+    else
+    {
+      for (f = 0U; f < frames; f++)
+      {
+        x[f] = (int16_t)src[(slots * f)];
+        y[f] = (int16_t)src[(slots * f) + 1U];
+        z[f] = (int16_t)src[(slots * f) + 2U];
+      }
+    }
+
+    for (i = 0U; i < 3U; i++)
+    {
+      if (data[d].mg[i] != NULL)
+      {
+        for (f = 0U; f < frames; f++)
+        {
+          data[d].mg[i][f] = lis25ba_from_raw_to_mg(data[d].raw[i][f]);
+        }
+      }
+    }
+  }
+
+  return 0;
+}
+
 /**
   * @brief  Linear acceleration sensor self-test enable.[set]
   *
@@ -375,6 +375,15 @@ typedef struct
 int32_t lis25ba_data_get(uint16_t *tdm_stream, lis25ba_bus_mode_t *md,
                          lis25ba_data_t *data);
 
+typedef struct
+{
+  int16_t *raw[3];  /* per axis, one sample per frame */
+  float_t *mg[3];   /* per axis, NULL to skip the conversion */
+} lis25ba_data_multi_t;
+int32_t lis25ba_data_multi_get(const uint16_t *tdm_stream, uint16_t frames,
+                               uint8_t slots, lis25ba_bus_mode_t *md,
+                               lis25ba_data_multi_t *data, uint8_t devs);
+
 int32_t lis25ba_self_test_set(const stmdev_ctx_t *ctx, uint8_t val);
 int32_t lis25ba_self_test_get(const stmdev_ctx_t *ctx, uint8_t *val);
 
@@ -109,6 +109,37 @@ float_t lps22ch_from_lsb_to_celsius(int16_t lsb)
   return ((float_t) lsb / 100.0f);
 }
 
+/**
+  * @brief  Pressure to altitude over the reference pressure level [m].
+  *         International barometric formula
+  *         44330 * (1 - (p / p_ref)^(1 / 5.255)) approximated with a
+  *         6th order polynomial in (p / p_ref - 1); the error is below
+  *         0.1 m for 0.45 < p / p_ref < 1.15.
+  *
+  */
+static inline float_t lps22ch_altitude_poly(float_t x)
+{
+  return x * (-8435.396f + x * (3407.530f + x * (-2109.064f +
+              x * (1712.928f + x * (859.469f + x * 4137.405f)))));
+}
+
+float_t lps22ch_from_hpa_to_altitude(float_t hpa, float_t hpa_ref)
+{
+  return lps22ch_altitude_poly((hpa / hpa_ref) - 1.0f);
+}
+
+void lps22ch_from_hpa_to_altitude_array(const float_t *hpa, float_t *altitude,
+                                        uint16_t len, float_t hpa_ref)
+{
+  float_t ratio = 1.0f / hpa_ref;
+  uint16_t i;
+
+  for (i = 0U; i < len; i++)
+  {
+    altitude[i] = lps22ch_altitude_poly((hpa[i] * ratio) - 1.0f);
+  }
+}
+
 /**
   * @}
   *
@@ -744,6 +775,48 @@ int32_t lps22ch_fifo_temperature_raw_get(const stmdev_ctx_t *ctx,
   return ret;
 }
 
+/**
+  * @brief  Burst read of FIFO output data.[get]
+  *         The register address rolls back from FIFO_DATA_OUT_TEMP_H to
+  *         FIFO_DATA_OUT_PRESS_XL, so the FIFO is drained with a single
+  *         bus transaction instead of two per sample.
+  *
+  * @param  ctx      read / write interface definitions
+  * @param  buff     buffer that stores data read
+  * @param  len      number of pressure-temperature pairs to read
+  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t lps22ch_fifo_output_data_burst_get(const stmdev_ctx_t *ctx,
+                                           lps22ch_fifo_output_data_t *buff,
+                                           uint8_t len)
+{
+  if (len > 128U)
+  {
+    len = 128U;
+  }
+
+  return lps22ch_read_reg(ctx, LPS22CH_FIFO_DATA_OUT_PRESS_XL, (uint8_t *)&buff[0],
+                          (uint16_t)len * sizeof(lps22ch_fifo_output_data_t));
+}
+
+uint32_t lps22ch_fifo_output_data_to_raw_pressure(lps22ch_fifo_output_data_t *val)
+{
+  uint32_t pressure = val->bytes[2];
+
+  pressure = (pressure * 256U) + val->bytes[1];
+  pressure = (pressure * 256U) + val->bytes[0];
+
+  return pressure * 256U;
+}
+
+int16_t lps22ch_fifo_output_data_to_raw_temperature(lps22ch_fifo_output_data_t *val)
+{
+  int16_t temperature = (int16_t)val->bytes[4];
+
+  return (temperature * 256) + (int16_t)val->bytes[3];
+}
+
 /**
   * @}
   *
@@ -128,6 +128,37 @@ float_t lps22df_from_lsb_to_celsius(int16_t lsb)
   return ((float_t)lsb / 100.0f);
 }
 
+/**
+  * @brief  Pressure to altitude over the reference pressure level [m].
+  *         International barometric formula
+  *         44330 * (1 - (p / p_ref)^(1 / 5.255)) approximated with a
+  *         6th order polynomial in (p / p_ref - 1); the error is below
+  *         0.1 m for 0.45 < p / p_ref < 1.15.
+  *
+  */
+static inline float_t lps22df_altitude_poly(float_t x)
+{
+  return x * (-8435.396f + x * (3407.530f + x * (-2109.064f +
+              x * (1712.928f + x * (859.469f + x * 4137.405f)))));
+}
+
+float_t lps22df_from_hPa_to_altitude(float_t hpa, float_t hpa_ref)
+{
+  return lps22df_altitude_poly((hpa / hpa_ref) - 1.0f);
+}
+
+void lps22df_from_hPa_to_altitude_array(const float_t *hpa, float_t *altitude,
+                                        uint16_t len, float_t hpa_ref)
+{
+  float_t ratio = 1.0f / hpa_ref;
+  uint16_t i;
+
+  for (i = 0U; i < len; i++)
+  {
+    altitude[i] = lps22df_altitude_poly((hpa[i] * ratio) - 1.0f);
+  }
+}
+
 /**
   * @}
   *
@@ -911,12 +942,24 @@ int32_t lps22df_fifo_level_get(const stmdev_ctx_t *ctx, uint8_t *val)
 int32_t lps22df_fifo_data_get(const stmdev_ctx_t *ctx, uint8_t samp, lps22df_fifo_data_t *data)
 {
   uint8_t fifo_data[3];
+  uint8_t *raw;
   uint8_t i;
-  int32_t ret = 0;
+  int32_t ret;
+
+  /*
+   * Drain the FIFO with a single burst: the register address rolls back
+   * from FIFO_DATA_OUT_PRESS_H to FIFO_DATA_OUT_PRESS_XL. Raw samples are
+   * stored at the tail of the output array and decoded front to back, so
+   * each one is fetched before data[i] overwrites it.
+   */
+  raw = (uint8_t *)data + ((sizeof(lps22df_fifo_data_t) - 3U) * samp);
+  ret = lps22df_read_reg(ctx, LPS22DF_FIFO_DATA_OUT_PRESS_XL, raw, (uint16_t)samp * 3U);
 
-  for (i = 0U; i < samp; i++)
+  for (i = 0U; (ret == 0) && (i < samp); i++)
   {
-    ret = lps22df_read_reg(ctx, LPS22DF_FIFO_DATA_OUT_PRESS_XL, fifo_data, 3);
+    fifo_data[0] = raw[3U * i];
+    fifo_data[1] = raw[(3U * i) + 1U];
+    fifo_data[2] = raw[(3U * i) + 2U];
     data[i].raw = (int32_t)fifo_data[2];
     data[i].raw = (data[i].raw * 256) + (int32_t)fifo_data[1];
     data[i].raw = (data[i].raw * 256) + (int32_t)fifo_data[0];
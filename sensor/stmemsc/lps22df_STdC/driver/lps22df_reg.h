@@ -510,6 +510,9 @@ int32_t lps22df_write_reg(const stmdev_ctx_t *ctx, uint8_t reg,
 
 extern float_t lps22df_from_lsb_to_hPa(int32_t lsb);
 extern float_t lps22df_from_lsb_to_celsius(int16_t lsb);
+extern float_t lps22df_from_hPa_to_altitude(float_t hpa, float_t hpa_ref);
+extern void lps22df_from_hPa_to_altitude_array(const float_t *hpa, float_t *altitude,
+                                               uint16_t len, float_t hpa_ref);
 
 typedef struct
 {
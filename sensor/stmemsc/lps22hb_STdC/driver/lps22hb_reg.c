@@ -123,6 +123,37 @@ float_t lps22hb_from_lsb_to_altitude(int32_t lsb)
   return 44330.0 * (1.0 - pow(atmospheric / 1013.25f, (1.0 / 5.255)));
 }
 
+/**
+  * @brief  Pressure to altitude over the reference pressure level [m].
+  *         International barometric formula
+  *         44330 * (1 - (p / p_ref)^(1 / 5.255)) approximated with a
+  *         6th order polynomial in (p / p_ref - 1); the error is below
+  *         0.1 m for 0.45 < p / p_ref < 1.15.
+  *
+  */
+static inline float_t lps22hb_altitude_poly(float_t x)
+{
+  return x * (-8435.396f + x * (3407.530f + x * (-2109.064f +
+              x * (1712.928f + x * (859.469f + x * 4137.405f)))));
+}
+
+float_t lps22hb_from_hpa_to_altitude(float_t hpa, float_t hpa_ref)
+{
+  return lps22hb_altitude_poly((hpa / hpa_ref) - 1.0f);
+}
+
+void lps22hb_from_hpa_to_altitude_array(const float_t *hpa, float_t *altitude,
+                                        uint16_t len, float_t hpa_ref)
+{
+  float_t ratio = 1.0f / hpa_ref;
+  uint16_t i;
+
+  for (i = 0U; i < len; i++)
+  {
+    altitude[i] = lps22hb_altitude_poly((hpa[i] * ratio) - 1.0f);
+  }
+}
+
 float_t lps22hb_from_lsb_to_degc(int16_t lsb)
 {
   return ((float_t)lsb / 100.0f);
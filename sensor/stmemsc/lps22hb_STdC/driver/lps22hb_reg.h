@@ -424,6 +424,10 @@ float_t lps22hb_from_lsb_to_psi(int32_t lsb);
 
 float_t lps22hb_from_lsb_to_altitude(int32_t lsb);
 
+float_t lps22hb_from_hpa_to_altitude(float_t hpa, float_t hpa_ref);
+void lps22hb_from_hpa_to_altitude_array(const float_t *hpa, float_t *altitude,
+                                        uint16_t len, float_t hpa_ref);
+
 float_t lps22hb_from_lsb_to_degc(int16_t lsb);
 
 int32_t lps22hb_autozero_rst_set(const stmdev_ctx_t *ctx, uint8_t val);
@@ -457,6 +457,10 @@ float_t lps22hh_from_lsb_to_hpa(uint32_t lsb);
 
 float_t lps22hh_from_lsb_to_celsius(int16_t lsb);
 
+float_t lps22hh_from_hpa_to_altitude(float_t hpa, float_t hpa_ref);
+void lps22hh_from_hpa_to_altitude_array(const float_t *hpa, float_t *altitude,
+                                        uint16_t len, float_t hpa_ref);
+
 int32_t lps22hh_autozero_rst_set(const stmdev_ctx_t *ctx, uint8_t val);
 int32_t lps22hh_autozero_rst_get(const stmdev_ctx_t *ctx, uint8_t *val);
 
@@ -528,6 +532,19 @@ int32_t lps22hh_fifo_pressure_raw_get(const stmdev_ctx_t *ctx,
 int32_t lps22hh_fifo_temperature_raw_get(const stmdev_ctx_t *ctx,
                                          int16_t *buff);
 
+typedef struct __attribute__((packed)) _lps22hh_fifo_output_data_t
+{
+  uint8_t bytes[5];
+} lps22hh_fifo_output_data_t;
+
+int32_t lps22hh_fifo_output_data_burst_get(const stmdev_ctx_t *ctx,
+                                           lps22hh_fifo_output_data_t *buff,
+                                           uint8_t len);
+
+uint32_t lps22hh_fifo_output_data_to_raw_pressure(lps22hh_fifo_output_data_t *val);
+
+int16_t lps22hh_fifo_output_data_to_raw_temperature(lps22hh_fifo_output_data_t *val);
+
 int32_t lps22hh_device_id_get(const stmdev_ctx_t *ctx, uint8_t *buff);
 
 int32_t lps22hh_reset_set(const stmdev_ctx_t *ctx, uint8_t val);
@@ -508,6 +508,9 @@ extern float_t lps28dfw_from_fs1260_to_hPa(int32_t lsb);
 extern float_t lps28dfw_from_fs4000_to_hPa(int32_t lsb);
 
 extern float_t lps28dfw_from_lsb_to_celsius(int16_t lsb);
+extern float_t lps28dfw_from_hPa_to_altitude(float_t hpa, float_t hpa_ref);
+extern void lps28dfw_from_hPa_to_altitude_array(const float_t *hpa, float_t *altitude,
+                                                uint16_t len, float_t hpa_ref);
 
 typedef struct
 {
@@ -3248,6 +3248,228 @@ int32_t lsm6dso16is_ispu_read_memory(const stmdev_ctx_t *ctx,
   return ret;
 }
 
+/**
+  * @brief  CRC-32 (IEEE 802.3) of a buffer, nibble table based.
+  *
+  * @param  crc      previous CRC (0 for the first block)
+  * @param  data     data
+  * @param  len      data length
+  * @retval          updated CRC
+  *
+  */
+uint32_t lsm6dso16is_ispu_crc32(uint32_t crc, const uint8_t *data, uint32_t len)
+{
+  static const uint32_t crc_tab[16] =
+  {
+    0x00000000U, 0x1DB71064U, 0x3B6E20C8U, 0x26D930ACU,
+    0x76DC4190U, 0x6B6B51F4U, 0x4DB26158U, 0x5005713CU,
+    0xEDB88320U, 0xF00F9344U, 0xD6D6A3E8U, 0xCB61B38CU,
+    0x9B64C2B0U, 0x86D3D2D4U, 0xA00AE278U, 0xBDBDF21CU,
+  };
+  uint32_t i;
+
+  crc = ~crc;
+  for (i = 0U; i < len; i++)
+  {
+    crc ^= data[i];
+    crc = (crc >> 4) ^ crc_tab[crc & 0x0FU];
+    crc = (crc >> 4) ^ crc_tab[crc & 0x0FU];
+  }
+
+  return ~crc;
+}
+
+static int32_t lsm6dso16is_ispu_load_section(const stmdev_ctx_t *ctx,
+                                             const lsm6dso16is_ispu_section_t *sec)
+{
+  uint8_t addr[2];
+  uint16_t len;
+  uint16_t next;
+  uint16_t i = 0U;
+  int32_t ret = 0;
+
+  /* program RAM can not be written across 0x2000 boundaries */
+  while ((ret == 0) && (i < sec->len))
+  {
+    len = sec->len - i;
+    if (sec->mem_sel == LSM6DSO16IS_ISPU_PROGRAM_RAM_MEMORY)
+    {
+      next = (uint16_t)(((sec->addr + i) & 0xE000U) + 0x2000U);
+      if ((uint32_t)(sec->addr + i) + len > next)
+      {
+        len = next - (sec->addr + i);
+      }
+    }
+
+    /* MEM_ADDR1 and MEM_ADDR0 are contiguous: one transaction */
+    addr[0] = (uint8_t)((sec->addr + i) / 256U);
+    addr[1] = (uint8_t)((sec->addr + i) & 0xFFU);
+    ret = lsm6dso16is_write_reg(ctx, LSM6DSO16IS_ISPU_MEM_ADDR1, addr, 2);
+    if (ret == 0)
+    {
+      ret = lsm6dso16is_write_reg(ctx, LSM6DSO16IS_ISPU_MEM_DATA,
+                                  (uint8_t *)&sec->data[i], len);
+    }
+    i += len;
+  }
+
+  return ret;
+}
+
+static int32_t lsm6dso16is_ispu_verify_section(const stmdev_ctx_t *ctx,
+                                               const lsm6dso16is_ispu_section_t *sec)
+{
+  lsm6dso16is_ispu_mem_sel_t ispu_mem_sel = {0};
+  uint8_t buff[LSM6DSO16IS_ISPU_VERIFY_CHUNK];
+  uint8_t addr[2];
+  uint32_t crc = 0U;
+  uint16_t len;
+  uint16_t i;
+  int32_t ret;
+
+  ispu_mem_sel.read_mem_en = 1;
+  ispu_mem_sel.mem_sel = (uint8_t)sec->mem_sel;
+  ret = lsm6dso16is_write_reg(ctx, LSM6DSO16IS_ISPU_MEM_SEL, (uint8_t *)&ispu_mem_sel, 1);
+
+  addr[0] = (uint8_t)(sec->addr / 256U);
+  addr[1] = (uint8_t)(sec->addr & 0xFFU);
+  ret += lsm6dso16is_write_reg(ctx, LSM6DSO16IS_ISPU_MEM_ADDR1, addr, 2);
+
+  /* first read after the address selection is a dummy one */
+  ret += lsm6dso16is_read_reg(ctx, LSM6DSO16IS_ISPU_MEM_DATA, buff, 1);
+
+  for (i = 0U; (ret == 0) && (i < sec->len); i += len)
+  {
+    len = sec->len - i;
+    len = (len > LSM6DSO16IS_ISPU_VERIFY_CHUNK) ? LSM6DSO16IS_ISPU_VERIFY_CHUNK : len;
+    ret = lsm6dso16is_read_reg(ctx, LSM6DSO16IS_ISPU_MEM_DATA, buff, len);
+    crc = lsm6dso16is_ispu_crc32(crc, buff, len);
+  }
+
+  if ((ret == 0) && (crc != sec->crc))
+  {
+    ret = -1;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  ISPU image loader. The sections (from the linked image) are
+  *         written with one burst each (program RAM is split only at its
+  *         0x2000 boundaries), with a single bank switch and ISPU clock
+  *         gating for the whole image. When verify is set, each section
+  *         is read back in LSM6DSO16IS_ISPU_VERIFY_CHUNK bursts and checked
+  *         against its CRC-32, so no copy of the image is needed.
+  *
+  * @param  ctx      read / write interface definitions
+  * @param  sec      image sections
+  * @param  num      number of sections
+  * @param  verify   PROPERTY_ENABLE to verify the CRC of every section
+  * @retval          interface status (MANDATORY: return 0 -> no Error),
+  *                  -1 also on CRC mismatch
+  *
+  */
+int32_t lsm6dso16is_ispu_load(const stmdev_ctx_t *ctx,
+                              const lsm6dso16is_ispu_section_t *sec, uint16_t num,
+                              uint8_t verify)
+{
+  lsm6dso16is_ispu_mem_sel_t ispu_mem_sel = {0};
+  lsm6dso16is_ispu_config_t ispu_cfg;
+  uint8_t mem_sel = 0xFFU;
+  uint8_t clk_dis;
+  int32_t ret;
+  uint16_t i;
+
+  ret = lsm6dso16is_mem_bank_set(ctx, LSM6DSO16IS_ISPU_MEM_BANK);
+  if (ret != 0)
+  {
+    return ret;
+  }
+
+  /* disable ISPU clock */
+  ret = lsm6dso16is_read_reg(ctx, LSM6DSO16IS_ISPU_CONFIG, (uint8_t *)&ispu_cfg, 1);
+  if (ret != 0)
+  {
+    goto exit;
+  }
+  clk_dis = ispu_cfg.clk_dis;
+  ispu_cfg.clk_dis = 1;
+  ret = lsm6dso16is_write_reg(ctx, LSM6DSO16IS_ISPU_CONFIG, (uint8_t *)&ispu_cfg, 1);
+
+  for (i = 0U; (ret == 0) && (i < num); i++)
+  {
+    /* select memory to be written only when it changes */
+    if ((uint8_t)sec[i].mem_sel != mem_sel)
+    {
+      mem_sel = (uint8_t)sec[i].mem_sel;
+      ispu_mem_sel.read_mem_en = 0;
+      ispu_mem_sel.mem_sel = mem_sel;
+      ret = lsm6dso16is_write_reg(ctx, LSM6DSO16IS_ISPU_MEM_SEL, (uint8_t *)&ispu_mem_sel, 1);
+    }
+
+    if (ret == 0)
+    {
+      ret = lsm6dso16is_ispu_load_section(ctx, &sec[i]);
+    }
+  }
+
+  for (i = 0U; (ret == 0) && (verify == PROPERTY_ENABLE) && (i < num); i++)
+  {
+    ret = lsm6dso16is_ispu_verify_section(ctx, &sec[i]);
+  }
+
+  /* set ISPU clock back to previous value */
+  ispu_cfg.clk_dis = clk_dis;
+  ret += lsm6dso16is_write_reg(ctx, LSM6DSO16IS_ISPU_CONFIG, (uint8_t *)&ispu_cfg, 1);
+
+exit:
+  ret += lsm6dso16is_mem_bank_set(ctx, LSM6DSO16IS_MAIN_MEM_BANK);
+
+  return ret;
+}
+
+/**
+  * @brief  Boot the ISPU core and poll its boot status (ctx->mdelay is
+  *         used between polls, when available).
+  *
+  * @param  ctx      read / write interface definitions
+  * @param  timeout  maximum number of 1 ms polls
+  * @retval          interface status (MANDATORY: return 0 -> no Error),
+  *                  -1 also on boot timeout
+  *
+  */
+int32_t lsm6dso16is_ispu_boot_wait(const stmdev_ctx_t *ctx, uint16_t timeout)
+{
+  lsm6dso16is_ispu_boot_end_t boot_end;
+  uint16_t cnt = 0U;
+  int32_t ret;
+
+  ret = lsm6dso16is_ispu_boot_set(ctx, LSM6DSO16IS_ISPU_TURN_ON);
+
+  while (ret == 0)
+  {
+    ret = lsm6dso16is_ispu_get_boot_status(ctx, &boot_end);
+    if ((ret != 0) || (boot_end == LSM6DSO16IS_ISPU_BOOT_ENDED))
+    {
+      break;
+    }
+
+    if (cnt++ >= timeout)
+    {
+      ret = -1;  /* boot procedure failed */
+      break;
+    }
+
+    if (ctx->mdelay != NULL)
+    {
+      ctx->mdelay(1);
+    }
+  }
+
+  return ret;
+}
+
 /**
   * @brief  ISPU write flags (IF2S)
   *
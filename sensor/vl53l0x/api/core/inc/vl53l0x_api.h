@@ -411,6 +411,10 @@ VL53L0X_API VL53L0X_Error VL53L0X_DataInit(VL53L0X_DEV Dev);
  * the API to write tuning settings.
  * This function permit to force the usage of either external or internal
  * tuning settings.
+ * Each entry of the buffer is written with a single I2C transfer (split to
+ * VL53L0X_MAX_I2C_XFER_SIZE), so consecutive registers should be merged in
+ * one entry. A page select (register 0xFF) to the page already selected is
+ * skipped.
  *
  * @note This function Access to the device
  *
@@ -1490,6 +1494,10 @@ VL53L0X_API VL53L0X_Error VL53L0X_GetMeasurementRefSignal(VL53L0X_DEV Dev,
  * before get data.
  * PAL will fill a NumberOfROIZones times the corresponding data
  * structure used in the measurement function.
+ * The result is read with a single 12 bytes access; range status, sigma
+ * and DMAX are computed from it with the timing terms cached at
+ * @a VL53L0X_StaticInit(). Only VL53L0X_CHECKENABLE_SIGNAL_REF_CLIP, off by
+ * default, needs an extra read of the reference signal rate.
  *
  * @note This function Access to the device
  *
@@ -1511,7 +1519,8 @@ VL53L0X_API VL53L0X_Error VL53L0X_GetRangingMeasurementData(VL53L0X_DEV Dev,
  * PAL will fill a NumberOfROIZones times the corresponding data structure
  * used in the measurement function.
  *
- * @note This function is not Implemented
+ * @note This function is not Implemented, the histogram readout of the
+ * VL53L0X is not documented.
  *
  * @param   Dev                         Device Handle
  * @param   pHistogramMeasurementData   Pointer to the histogram data structure.
@@ -1555,7 +1564,8 @@ VL53L0X_API VL53L0X_Error VL53L0X_PerformSingleRangingMeasurement(VL53L0X_DEV De
  * Get data from last successful Ranging measurement.
  * This function will clear the interrupt in case of these are enabled.
  *
- * @note This function is not Implemented
+ * @note This function is not Implemented, see
+ * @a VL53L0X_GetHistogramMeasurementData()
  *
  * @param   Dev                        Device Handle
  * @param   pHistogramMeasurementData  Pointer to the data structure to fill up.
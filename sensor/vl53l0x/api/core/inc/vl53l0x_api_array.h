@@ -0,0 +1,220 @@
+/*******************************************************************************
+Copyright  2016, STMicroelectronics International N.V.
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of STMicroelectronics nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, AND
+NON-INFRINGEMENT OF INTELLECTUAL PROPERTY RIGHTS ARE DISCLAIMED.
+IN NO EVENT SHALL STMICROELECTRONICS INTERNATIONAL N.V. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+
+/**
+ * @file  vl53l0x_api_array.h
+ *
+ * @brief Persistent calibration records and phased boot of several devices
+ * sharing one I2C bus
+ */
+
+#ifndef _VL53L0X_API_ARRAY_H_
+#define _VL53L0X_API_ARRAY_H_
+
+#include "vl53l0x_api.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @defgroup VL53L0X_array_group VL53L0X Sensor Array Functions
+ *  @brief    Calibration records that survive power off, and bring-up of up
+ *            to VL53L0X_ARRAY_MAX_DEVICES sensors with the calibration
+ *            steps interleaved across devices
+ *  @{
+ */
+
+#ifndef VL53L0X_ARRAY_MAX_DEVICES
+#define VL53L0X_ARRAY_MAX_DEVICES 8
+/*!< Maximum number of devices handled by one array */
+#endif
+
+#if VL53L0X_ARRAY_MAX_DEVICES > 8
+#error VL53L0X_ARRAY_MAX_DEVICES must be at most 8, masks are 8 bit
+#endif
+
+#define VL53L0X_ARRAY_DEFAULT_ADDRESS 0x52
+/*!< 8-bit I2C address of a device coming out of XSHUTDOWN */
+
+#define VL53L0X_CALIBRATION_RECORD_VERSION 1
+/*!< Layout version stored in the first byte of a record */
+
+#define VL53L0X_CALIBRATION_RECORD_SIZE 16
+/*!< Size of a calibration record in bytes */
+
+/** @brief Calibration record, to be stored as is in non volatile memory
+ *
+ * Byte layout, multi-byte fields big endian:
+ * - 0      VL53L0X_CALIBRATION_RECORD_VERSION
+ * - 1      reference SPAD count
+ * - 2      reference SPAD type, 1 for aperture SPADs
+ * - 3      VHV settings
+ * - 4      phase calibration
+ * - 5      crosstalk compensation enable
+ * - 6..9   offset in um
+ * - 10..13 crosstalk compensation rate, FixPoint1616 MCps
+ * - 14..15 CRC-16-CCITT (0x1021, initial value 0xFFFF) of bytes 0..13
+ */
+typedef struct {
+
+	uint8_t   Data[VL53L0X_CALIBRATION_RECORD_SIZE];
+
+} VL53L0X_CalibrationRecord_t;
+
+/** @brief Drives the XSHUTDOWN pin of device Index (0 = reset, 1 = run)
+ *
+ * When releasing a device it must only return once the device has booted
+ * (1.2 ms max after the rising edge).
+ */
+typedef VL53L0X_Error (*VL53L0X_ArrayXShutFunc)(void *pCtx, uint8_t Index,
+	uint8_t Level);
+
+/** @brief Updates the platform handle of device Index to a new 8-bit I2C
+ *         address (the device itself is readdressed by the array manager)
+ */
+typedef VL53L0X_Error (*VL53L0X_ArraySetAddressFunc)(void *pCtx,
+	uint8_t Index, uint8_t DeviceAddress);
+
+/** @brief Sensor array description and state
+ */
+typedef struct {
+
+	uint8_t   NumberOfDevices;
+	/*!< Number of devices in use, up to VL53L0X_ARRAY_MAX_DEVICES */
+	VL53L0X_DEV Dev[VL53L0X_ARRAY_MAX_DEVICES];
+	/*!< Device handles */
+	uint8_t   DeviceAddress[VL53L0X_ARRAY_MAX_DEVICES];
+	/*!< 8-bit I2C address assigned to each device, all distinct, only
+	 * the last device may keep the default address when XShut is set */
+	VL53L0X_ArrayXShutFunc      XShut;
+	/*!< Platform XSHUTDOWN control, NULL if devices are already up */
+	VL53L0X_ArraySetAddressFunc SetAddress;
+	/*!< Platform address update, NULL if devices are already addressed */
+	void     *pCtx;
+	/*!< Platform context passed back to XShut and SetAddress */
+	VL53L0X_CalibrationRecord_t *pRecord;
+	/*!< NumberOfDevices records read back from non volatile memory, or
+	 * NULL to calibrate every device */
+	uint8_t   RestoreRefCalibration;
+	/*!< 1 to also restore VHV and phase from valid records, 0 to run
+	 * them again (they drift with temperature) */
+
+	uint8_t   RecordUpdateMask;
+	/*!< Bit n set when record n was invalid and has been rewritten from
+	 * a fresh calibration, to be saved by the caller */
+
+} VL53L0X_Array_t;
+
+
+/**
+ * @brief Fill a calibration record from the device
+ *
+ * @par Function Description
+ * Reads the reference SPADs, VHV and phase calibration, offset and
+ * crosstalk compensation in use and seals them with the CRC.
+ *
+ * @note This function Access to the device
+ *
+ * @param   Dev                   Device Handle
+ * @param   pRecord               Pointer to the record to fill
+ * @return  VL53L0X_ERROR_NONE     Success
+ * @return  "Other error code"    See ::VL53L0X_Error
+ */
+VL53L0X_API VL53L0X_Error VL53L0X_GetCalibrationRecord(VL53L0X_DEV Dev,
+	VL53L0X_CalibrationRecord_t *pRecord);
+
+/**
+ * @brief Check the version and CRC of a calibration record
+ *
+ * @note This function doesn't Access to the device
+ *
+ * @param   pRecord               Pointer to the record
+ * @param   pValid                1 if the record can be restored
+ * @return  VL53L0X_ERROR_NONE     Success
+ */
+VL53L0X_API VL53L0X_Error VL53L0X_CheckCalibrationRecord(
+	const VL53L0X_CalibrationRecord_t *pRecord, uint8_t *pValid);
+
+/**
+ * @brief Apply a calibration record to the device
+ *
+ * @par Function Description
+ * Restores the reference SPADs with @a VL53L0X_SetReferenceSpads(), VHV
+ * and phase with @a VL53L0X_SetRefCalibration() when
+ * RestoreRefCalibration is 1, then the offset and the crosstalk
+ * compensation. Replaces @a VL53L0X_PerformRefSpadManagement() and
+ * @a VL53L0X_PerformRefCalibration() after @a VL53L0X_StaticInit().
+ *
+ * @note This function Access to the device
+ *
+ * @param   Dev                   Device Handle
+ * @param   pRecord               Pointer to the record
+ * @param   RestoreRefCalibration 1 to restore VHV and phase too
+ * @return  VL53L0X_ERROR_NONE            Success
+ * @return  VL53L0X_ERROR_INVALID_PARAMS  Bad version, CRC or SPAD count
+ * @return  "Other error code"            See ::VL53L0X_Error
+ */
+VL53L0X_API VL53L0X_Error VL53L0X_SetCalibrationRecord(VL53L0X_DEV Dev,
+	const VL53L0X_CalibrationRecord_t *pRecord,
+	uint8_t RestoreRefCalibration);
+
+/**
+ * @brief Boot, initialise and calibrate every device of the array
+ *
+ * @par Function Description
+ * Runs the bring-up in phases over all the devices rather than device by
+ * device: release from XSHUTDOWN and readdressing (serial, every device
+ * boots on the default address), @a VL53L0X_DataInit(),
+ * @a VL53L0X_StaticInit(), then the calibration in the order of
+ * @a VL53L0X_PerformRefCalibration() and
+ * @a VL53L0X_PerformRefSpadManagement():
+ * - valid records are applied with @a VL53L0X_SetCalibrationRecord();
+ * - VHV and phase, unless restored from a valid record with
+ * RestoreRefCalibration at 1: each calibration is started on every device
+ * before waiting for the first one, so that they run concurrently;
+ * - reference SPADs of the devices without a valid record, one device at a
+ * time. Their records are then rewritten from the device and flagged in
+ * RecordUpdateMask.
+ *
+ * @note This function Access to the device
+ *
+ * @param   pArray                Pointer to the array description
+ * @return  VL53L0X_ERROR_NONE            Success
+ * @return  VL53L0X_ERROR_INVALID_PARAMS  Bad device count or addresses
+ * @return  "Other error code"            See ::VL53L0X_Error
+ */
+VL53L0X_API VL53L0X_Error VL53L0X_ArrayInit(VL53L0X_Array_t *pArray);
+
+/** @} VL53L0X_array_group */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _VL53L0X_API_ARRAY_H_ */
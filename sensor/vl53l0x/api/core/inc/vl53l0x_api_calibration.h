@@ -62,6 +62,11 @@ VL53L0X_Error VL53L0X_set_reference_spads(VL53L0X_DEV Dev,
 VL53L0X_Error VL53L0X_get_reference_spads(VL53L0X_DEV Dev,
 		uint32_t *pSpadCount, uint8_t *pIsApertureSpads);
 
+VL53L0X_Error VL53L0X_start_single_ref_calibration(VL53L0X_DEV Dev,
+		uint8_t vhv_init_byte);
+
+VL53L0X_Error VL53L0X_complete_single_ref_calibration(VL53L0X_DEV Dev);
+
 VL53L0X_Error VL53L0X_perform_phase_calibration(VL53L0X_DEV Dev,
 	uint8_t *pPhaseCal, const uint8_t get_data_enable,
 	const uint8_t restore_config);
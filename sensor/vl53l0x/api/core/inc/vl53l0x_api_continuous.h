@@ -0,0 +1,186 @@
+/*******************************************************************************
+Copyright  2016, STMicroelectronics International N.V.
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of STMicroelectronics nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, AND
+NON-INFRINGEMENT OF INTELLECTUAL PROPERTY RIGHTS ARE DISCLAIMED.
+IN NO EVENT SHALL STMICROELECTRONICS INTERNATIONAL N.V. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+
+/**
+ * @file  vl53l0x_api_continuous.h
+ *
+ * @brief Interrupt serviced continuous ranging with a lock-free result ring
+ */
+
+#ifndef _VL53L0X_API_CONTINUOUS_H_
+#define _VL53L0X_API_CONTINUOUS_H_
+
+#include "vl53l0x_api.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @defgroup VL53L0X_continuous_group VL53L0X Continuous Ranging Functions
+ *  @brief    Continuous ranging driven by the GPIO1 new sample ready
+ *            interrupt, results handed over through a single producer /
+ *            single consumer ring
+ *  @{
+ */
+
+#ifndef VL53L0X_RANGE_RING_DEPTH
+#define VL53L0X_RANGE_RING_DEPTH 8
+/*!< Number of ranges buffered between the interrupt service and the
+ * reader (power of two, up to 128) */
+#endif
+
+#if (VL53L0X_RANGE_RING_DEPTH & (VL53L0X_RANGE_RING_DEPTH - 1)) != 0 || \
+	VL53L0X_RANGE_RING_DEPTH > 128
+#error VL53L0X_RANGE_RING_DEPTH must be a power of two up to 128
+#endif
+
+#ifndef VL53L0X_RANGE_RING_BARRIER
+#if defined(__GNUC__)
+#define VL53L0X_RANGE_RING_BARRIER() __sync_synchronize()
+/*!< Orders the ring slot access against the index update */
+#else
+#error VL53L0X_RANGE_RING_BARRIER must be defined for this compiler
+#endif
+#endif
+
+/** @brief Result ring shared by the interrupt service and the reader
+ *
+ * Head is only written by @a VL53L0X_ServiceContinuousRanging(), Tail only
+ * by @a VL53L0X_RangeRingPop(), so no lock is needed as long as each side
+ * runs in a single context. Both indexes run freely, the fill level is
+ * Head - Tail.
+ */
+typedef struct {
+
+	VL53L0X_RangingMeasurementData_t Data[VL53L0X_RANGE_RING_DEPTH];
+	/*!< Ring of ranging results */
+	volatile uint32_t Head;    /*!< Number of ranges pushed */
+	volatile uint32_t Tail;    /*!< Number of ranges popped */
+	uint32_t OverrunCount;
+	/*!< Ranges dropped because the ring was full, service side */
+	uint32_t ErrorCount;
+	/*!< Interrupts whose result could not be read, service side */
+
+} VL53L0X_RangeRing_t;
+
+
+/**
+ * @brief Start interrupt serviced continuous ranging
+ *
+ * @par Function Description
+ * Empties the ring, selects VL53L0X_DEVICEMODE_CONTINUOUS_RANGING (back to
+ * back) when InterMeasurementPeriodMilliSeconds is 0, otherwise
+ * VL53L0X_DEVICEMODE_CONTINUOUS_TIMED_RANGING with that period, routes the
+ * new sample ready interrupt to GPIO1 and starts ranging.
+ * The platform is expected to call @a VL53L0X_ServiceContinuousRanging() on
+ * every GPIO1 edge, there is no polling.
+ *
+ * @note This function Access to the device
+ *
+ * @param   Dev                   Device Handle
+ * @param   pRing                 Pointer to the result ring
+ * @param   InterMeasurementPeriodMilliSeconds   0 for back to back ranging
+ * @param   Polarity              GPIO1 interrupt polarity
+ * @return  VL53L0X_ERROR_NONE     Success
+ * @return  "Other error code"    See ::VL53L0X_Error
+ */
+VL53L0X_API VL53L0X_Error VL53L0X_StartContinuousRanging(VL53L0X_DEV Dev,
+	VL53L0X_RangeRing_t *pRing,
+	uint32_t InterMeasurementPeriodMilliSeconds,
+	VL53L0X_InterruptPolarity Polarity);
+
+/**
+ * @brief Service the new sample ready interrupt
+ *
+ * @par Function Description
+ * Reads the result with @a VL53L0X_GetRangingMeasurementData() straight
+ * into the next ring slot, then clears the interrupt with two writes of
+ * SYSTEM_INTERRUPT_CLEAR. Unlike @a VL53L0X_ClearInterruptMask() the clear
+ * is not read back: the next sample ready edge is the confirmation.
+ * With the default limit checks this is one 12 byte read and two byte
+ * writes per range.
+ * When the ring is full the result is not read, the interrupt is cleared
+ * and OverrunCount is incremented. When the read fails the interrupt is
+ * still cleared so that ranging does not stall, and ErrorCount is
+ * incremented.
+ *
+ * @note This function Access to the device. It must not run concurrently
+ * with any other function accessing the same device; call it from the
+ * thread or work item the GPIO callback defers to, not from the interrupt
+ * handler itself when the I2C driver may sleep.
+ *
+ * @param   Dev                   Device Handle
+ * @param   pRing                 Pointer to the result ring
+ * @return  VL53L0X_ERROR_NONE     Success
+ * @return  "Other error code"    See ::VL53L0X_Error
+ */
+VL53L0X_API VL53L0X_Error VL53L0X_ServiceContinuousRanging(VL53L0X_DEV Dev,
+	VL53L0X_RangeRing_t *pRing);
+
+/**
+ * @brief Take the oldest range out of the ring
+ *
+ * @note This function doesn't Access to the device, it may run concurrently
+ * with @a VL53L0X_ServiceContinuousRanging().
+ *
+ * @param   pRing                 Pointer to the result ring
+ * @param   pRangingMeasurementData  Pointer to the data structure to fill up
+ * @param   pDataAvailable        1 if a range was returned, 0 if the ring
+ * was empty
+ * @return  VL53L0X_ERROR_NONE     Success
+ */
+VL53L0X_API VL53L0X_Error VL53L0X_RangeRingPop(VL53L0X_RangeRing_t *pRing,
+	VL53L0X_RangingMeasurementData_t *pRangingMeasurementData,
+	uint8_t *pDataAvailable);
+
+/**
+ * @brief Stop interrupt serviced continuous ranging
+ *
+ * @par Function Description
+ * Stops ranging, waits for the range in progress to complete, turns the
+ * GPIO1 interrupt off and goes back to
+ * VL53L0X_DEVICEMODE_SINGLE_RANGING. Ranges still in the ring can be
+ * popped afterwards.
+ *
+ * @note This function Access to the device
+ *
+ * @param   Dev                   Device Handle
+ * @return  VL53L0X_ERROR_NONE     Success
+ * @return  VL53L0X_ERROR_TIME_OUT The range in progress did not complete
+ * @return  "Other error code"    See ::VL53L0X_Error
+ */
+VL53L0X_API VL53L0X_Error VL53L0X_StopContinuousRanging(VL53L0X_DEV Dev);
+
+/** @} VL53L0X_continuous_group */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _VL53L0X_API_CONTINUOUS_H_ */
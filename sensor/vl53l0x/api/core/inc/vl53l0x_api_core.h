@@ -77,6 +77,9 @@ VL53L0X_Error VL53L0X_get_measurement_timing_budget_micro_seconds(VL53L0X_DEV De
 VL53L0X_Error VL53L0X_load_tuning_settings(VL53L0X_DEV Dev,
 		uint8_t *pTuningSettingBuffer);
 
+VL53L0X_Error VL53L0X_get_sigma_constants(VL53L0X_DEV Dev,
+		uint32_t *pPeakVcselDuration_us, FixPoint1616_t *pSigmaEstRef);
+
 VL53L0X_Error VL53L0X_calc_sigma_estimate(VL53L0X_DEV Dev,
 		VL53L0X_RangingMeasurementData_t *pRangingMeasurementData,
 		FixPoint1616_t *pSigmaEstimate, uint32_t *pDmax_mm);
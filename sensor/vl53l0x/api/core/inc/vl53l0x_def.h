@@ -85,6 +85,15 @@ extern "C" {
 #define VL53L0X_IMPLEMENTATION_VER_REVISION	  4823
 #define VL53L0X_DEFAULT_MAX_LOOP 2000
 #define VL53L0X_MAX_STRING_LENGTH 32
+#ifndef VL53L0X_MAX_I2C_XFER_SIZE
+/** Largest VL53L0X_WriteMulti() issued by the tuning settings loader */
+#define VL53L0X_MAX_I2C_XFER_SIZE 64
+#endif
+#ifndef VL53L0X_FAST_MATH
+/** 1 to compute the sigma and DMAX estimates with a table seeded square
+ * root and reciprocal multiplications, bit exact with the default 0 */
+#define VL53L0X_FAST_MATH 0
+#endif
 
 
 #include "vl53l0x_device.h"
@@ -378,6 +387,23 @@ typedef struct {
 	/*!< Reference Spad Good Spad Map */
 } VL53L0X_SpadData_t;
 
+/**
+ * @struct VL53L0X_SigmaConstants_t
+ * @brief Timing dependent terms of the sigma estimate, computed once per
+ * timing configuration instead of once per range.
+ */
+typedef struct {
+	uint8_t Valid; /*!< 1 once the fields below have been computed */
+	uint8_t FinalRangeVcselPulsePeriod; /*!< Key: final range vcsel period */
+	uint8_t PreRangeVcselPulsePeriod; /*!< Key: pre-range vcsel period */
+	uint32_t FinalRangeTimeoutMicroSecs; /*!< Key: final range timeout */
+	uint32_t PreRangeTimeoutMicroSecs; /*!< Key: pre-range timeout */
+	uint32_t PeakVcselDurationMicroSecs;
+	/*!< Vcsel on time over pre-range and final range */
+	FixPoint1616_t SigmaEstRef;
+	/*!< Reference array sigma scaled to the integration time */
+} VL53L0X_SigmaConstants_t;
+
 typedef struct {
 	FixPoint1616_t OscFrequencyMHz; /* Frequency used */
 
@@ -420,6 +446,9 @@ typedef struct {
 	FixPoint1616_t SignalRateMeasFixed400mm; /*!< Peek Signal rate
 	at 400 mm*/
 
+	VL53L0X_SigmaConstants_t SigmaConstants;
+	/*!< Cached timing terms of the sigma estimate */
+
 } VL53L0X_DeviceSpecificParameters_t;
 
 /**
@@ -422,6 +422,7 @@ VL53L0X_Error VL53L0X_DataInit(VL53L0X_DEV Dev)
 	PALDevDataSet(Dev, SigmaEstEffPulseWidth, 900);
 	PALDevDataSet(Dev, SigmaEstEffAmbWidth, 500);
 	PALDevDataSet(Dev, targetRefRate, 0x0A00); /* 20 MCPS in 9:7 format */
+	VL53L0X_SETDEVICESPECIFICPARAMETER(Dev, SigmaConstants.Valid, 0);
 
 	/* Use internal default settings */
 	PALDevDataSet(Dev, UseInternalTuningSettings, 1);
@@ -561,6 +562,8 @@ VL53L0X_Error VL53L0X_StaticInit(VL53L0X_DEV Dev)
 	uint8_t ApertureSpads = 0;
 	uint8_t vcselPulsePeriodPCLK;
 	uint32_t seqTimeoutMicroSecs;
+	uint32_t peakVcselDuration_us;
+	FixPoint1616_t sigmaEstRef;
 
 	LOG_FUNCTION_START("");
 
@@ -722,6 +725,12 @@ VL53L0X_Error VL53L0X_StaticInit(VL53L0X_DEV Dev)
 			seqTimeoutMicroSecs);
 	}
 
+	/* Compute the timing terms of the sigma estimate now rather than on
+	 * the first range */
+	if (Status == VL53L0X_ERROR_NONE)
+		Status = VL53L0X_get_sigma_constants(Dev,
+			&peakVcselDuration_us, &sigmaEstRef);
+
 	LOG_FUNCTION_END(Status);
 	return Status;
 }
@@ -0,0 +1,394 @@
+/*******************************************************************************
+ Copyright  2016, STMicroelectronics International N.V.
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright
+ notice, this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright
+ notice, this list of conditions and the following disclaimer in the
+ documentation and/or other materials provided with the distribution.
+ * Neither the name of STMicroelectronics nor the
+ names of its contributors may be used to endorse or promote products
+ derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, AND
+ NON-INFRINGEMENT OF INTELLECTUAL PROPERTY RIGHTS ARE DISCLAIMED.
+ IN NO EVENT SHALL STMICROELECTRONICS INTERNATIONAL N.V. BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+
+
+#include "vl53l0x_api_array.h"
+#include "vl53l0x_api_core.h"
+#include "vl53l0x_api_calibration.h"
+
+#define LOG_FUNCTION_START(fmt, ...) \
+	_LOG_FUNCTION_START(TRACE_MODULE_API, fmt, ##__VA_ARGS__)
+#define LOG_FUNCTION_END(status, ...) \
+	_LOG_FUNCTION_END(TRACE_MODULE_API, status, ##__VA_ARGS__)
+#define LOG_FUNCTION_END_FMT(status, fmt, ...) \
+	_LOG_FUNCTION_END_FMT(TRACE_MODULE_API, status, fmt, ##__VA_ARGS__)
+
+/* byte offsets in VL53L0X_CalibrationRecord_t */
+#define RECORD_VERSION          0
+#define RECORD_SPAD_COUNT       1
+#define RECORD_SPAD_TYPE        2
+#define RECORD_VHV_SETTINGS     3
+#define RECORD_PHASE_CAL        4
+#define RECORD_XTALK_ENABLE     5
+#define RECORD_OFFSET           6
+#define RECORD_XTALK_RATE       10
+#define RECORD_CRC              14
+
+
+static uint16_t RecordCrc(const uint8_t *pData)
+{
+	uint16_t Crc = 0xFFFF;
+	uint8_t i;
+	uint8_t j;
+
+	for (i = 0; i < RECORD_CRC; i++) {
+		Crc ^= (uint16_t)pData[i] << 8;
+		for (j = 0; j < 8; j++) {
+			if (Crc & 0x8000)
+				Crc = (uint16_t)((Crc << 1) ^ 0x1021);
+			else
+				Crc = (uint16_t)(Crc << 1);
+		}
+	}
+
+	return Crc;
+}
+
+
+static void RecordPut32(uint8_t *pData, uint32_t Value)
+{
+	pData[0] = (uint8_t)(Value >> 24);
+	pData[1] = (uint8_t)(Value >> 16);
+	pData[2] = (uint8_t)(Value >> 8);
+	pData[3] = (uint8_t)Value;
+}
+
+
+static uint32_t RecordGet32(const uint8_t *pData)
+{
+	return ((uint32_t)pData[0] << 24) | ((uint32_t)pData[1] << 16) |
+		((uint32_t)pData[2] << 8) | (uint32_t)pData[3];
+}
+
+
+VL53L0X_Error VL53L0X_GetCalibrationRecord(VL53L0X_DEV Dev,
+	VL53L0X_CalibrationRecord_t *pRecord)
+{
+	VL53L0X_Error Status = VL53L0X_ERROR_NONE;
+	uint8_t *pData = pRecord->Data;
+	uint32_t SpadCount = 0;
+	uint8_t IsApertureSpads = 0;
+	uint8_t VhvSettings = 0;
+	uint8_t PhaseCal = 0;
+	int32_t OffsetMicroMeter = 0;
+	FixPoint1616_t XTalkCompensationRateMegaCps;
+	uint8_t XTalkCompensationEnable = 0;
+	uint16_t Crc;
+
+	LOG_FUNCTION_START("");
+
+	Status = VL53L0X_GetReferenceSpads(Dev, &SpadCount, &IsApertureSpads);
+
+	if (Status == VL53L0X_ERROR_NONE)
+		Status = VL53L0X_GetRefCalibration(Dev, &VhvSettings,
+			&PhaseCal);
+
+	if (Status == VL53L0X_ERROR_NONE)
+		Status = VL53L0X_GetOffsetCalibrationDataMicroMeter(Dev,
+			&OffsetMicroMeter);
+
+	if (Status == VL53L0X_ERROR_NONE)
+		Status = VL53L0X_GetXTalkCompensationEnable(Dev,
+			&XTalkCompensationEnable);
+
+	/* the rate as configured, the register reads 0 while disabled */
+	VL53L0X_GETPARAMETERFIELD(Dev, XTalkCompensationRateMegaCps,
+		XTalkCompensationRateMegaCps);
+
+	if (Status == VL53L0X_ERROR_NONE) {
+		pData[RECORD_VERSION] = VL53L0X_CALIBRATION_RECORD_VERSION;
+		pData[RECORD_SPAD_COUNT] = (uint8_t)SpadCount;
+		pData[RECORD_SPAD_TYPE] = IsApertureSpads;
+		pData[RECORD_VHV_SETTINGS] = VhvSettings;
+		pData[RECORD_PHASE_CAL] = PhaseCal;
+		pData[RECORD_XTALK_ENABLE] = XTalkCompensationEnable;
+		RecordPut32(&pData[RECORD_OFFSET], (uint32_t)OffsetMicroMeter);
+		RecordPut32(&pData[RECORD_XTALK_RATE],
+			XTalkCompensationRateMegaCps);
+
+		Crc = RecordCrc(pData);
+		pData[RECORD_CRC] = (uint8_t)(Crc >> 8);
+		pData[RECORD_CRC + 1] = (uint8_t)Crc;
+	}
+
+	LOG_FUNCTION_END(Status);
+	return Status;
+}
+
+
+VL53L0X_Error VL53L0X_CheckCalibrationRecord(
+	const VL53L0X_CalibrationRecord_t *pRecord, uint8_t *pValid)
+{
+	VL53L0X_Error Status = VL53L0X_ERROR_NONE;
+	const uint8_t *pData = pRecord->Data;
+	uint16_t Crc;
+	uint8_t SpadCount = pData[RECORD_SPAD_COUNT];
+	uint8_t SpadType = pData[RECORD_SPAD_TYPE];
+
+	LOG_FUNCTION_START("");
+
+	Crc = ((uint16_t)pData[RECORD_CRC] << 8) | pData[RECORD_CRC + 1];
+
+	/* same SPAD limits as the NVM values checked in StaticInit */
+	*pValid = 1;
+	if ((pData[RECORD_VERSION] != VL53L0X_CALIBRATION_RECORD_VERSION) ||
+		(Crc != RecordCrc(pData)) ||
+		(SpadType > 1) ||
+		((SpadType == 1) && (SpadCount > 32)) ||
+		((SpadType == 0) && (SpadCount > 12)))
+		*pValid = 0;
+
+	LOG_FUNCTION_END(Status);
+	return Status;
+}
+
+
+VL53L0X_Error VL53L0X_SetCalibrationRecord(VL53L0X_DEV Dev,
+	const VL53L0X_CalibrationRecord_t *pRecord,
+	uint8_t RestoreRefCalibration)
+{
+	VL53L0X_Error Status = VL53L0X_ERROR_NONE;
+	const uint8_t *pData = pRecord->Data;
+	uint8_t Valid;
+
+	LOG_FUNCTION_START("");
+
+	Status = VL53L0X_CheckCalibrationRecord(pRecord, &Valid);
+
+	if ((Status == VL53L0X_ERROR_NONE) && (Valid == 0))
+		Status = VL53L0X_ERROR_INVALID_PARAMS;
+
+	if (Status == VL53L0X_ERROR_NONE)
+		Status = VL53L0X_SetReferenceSpads(Dev,
+			pData[RECORD_SPAD_COUNT], pData[RECORD_SPAD_TYPE]);
+
+	if ((Status == VL53L0X_ERROR_NONE) && (RestoreRefCalibration == 1))
+		Status = VL53L0X_SetRefCalibration(Dev,
+			pData[RECORD_VHV_SETTINGS], pData[RECORD_PHASE_CAL]);
+
+	if (Status == VL53L0X_ERROR_NONE)
+		Status = VL53L0X_SetOffsetCalibrationDataMicroMeter(Dev,
+			(int32_t)RecordGet32(&pData[RECORD_OFFSET]));
+
+	/* the rate is only written to the device while enabled, the enable
+	 * then writes the stored rate or 0
+	 */
+	if (Status == VL53L0X_ERROR_NONE)
+		Status = VL53L0X_SetXTalkCompensationRateMegaCps(Dev,
+			RecordGet32(&pData[RECORD_XTALK_RATE]));
+
+	if (Status == VL53L0X_ERROR_NONE)
+		Status = VL53L0X_SetXTalkCompensationEnable(Dev,
+			pData[RECORD_XTALK_ENABLE]);
+
+	LOG_FUNCTION_END(Status);
+	return Status;
+}
+
+
+static VL53L0X_Error ArrayBootAndAddress(VL53L0X_Array_t *pArray)
+{
+	VL53L0X_Error Status = VL53L0X_ERROR_NONE;
+	uint8_t i;
+
+	/* hold every device in reset so that only the one being
+	 * readdressed answers on the default address
+	 */
+	if (pArray->XShut != NULL) {
+		for (i = 0; (i < pArray->NumberOfDevices) &&
+			(Status == VL53L0X_ERROR_NONE); i++)
+			Status = pArray->XShut(pArray->pCtx, i, 0);
+	}
+
+	for (i = 0; (i < pArray->NumberOfDevices) &&
+		(Status == VL53L0X_ERROR_NONE) &&
+		(pArray->XShut != NULL); i++) {
+		Status = pArray->XShut(pArray->pCtx, i, 1);
+		if ((Status == VL53L0X_ERROR_NONE) &&
+			(pArray->SetAddress != NULL))
+			Status = pArray->SetAddress(pArray->pCtx, i,
+				VL53L0X_ARRAY_DEFAULT_ADDRESS);
+
+		if ((Status == VL53L0X_ERROR_NONE) &&
+			(pArray->DeviceAddress[i] !=
+			VL53L0X_ARRAY_DEFAULT_ADDRESS)) {
+			Status = VL53L0X_SetDeviceAddress(pArray->Dev[i],
+				pArray->DeviceAddress[i]);
+			if ((Status == VL53L0X_ERROR_NONE) &&
+				(pArray->SetAddress != NULL))
+				Status = pArray->SetAddress(pArray->pCtx, i,
+					pArray->DeviceAddress[i]);
+		}
+	}
+
+	return Status;
+}
+
+
+static VL53L0X_Error ArrayRefCalibration(VL53L0X_Array_t *pArray,
+	uint8_t Mask)
+{
+	/* VHV then phase, as VL53L0X_perform_ref_calibration() */
+	static const uint8_t SequenceConfig[2] = { 0x01, 0x02 };
+	static const uint8_t VhvInitByte[2] = { 0x40, 0x00 };
+	VL53L0X_Error Status = VL53L0X_ERROR_NONE;
+	uint8_t Step;
+	uint8_t i;
+
+	for (Step = 0; (Step < 2) && (Status == VL53L0X_ERROR_NONE); Step++) {
+		/* start on every device before waiting for any */
+		for (i = 0; (i < pArray->NumberOfDevices) &&
+			(Status == VL53L0X_ERROR_NONE); i++) {
+			if ((Mask & (1 << i)) == 0)
+				continue;
+			Status = VL53L0X_WrByte(pArray->Dev[i],
+				VL53L0X_REG_SYSTEM_SEQUENCE_CONFIG,
+				SequenceConfig[Step]);
+			if (Status == VL53L0X_ERROR_NONE)
+				Status = VL53L0X_start_single_ref_calibration(
+					pArray->Dev[i], VhvInitByte[Step]);
+		}
+
+		for (i = 0; (i < pArray->NumberOfDevices) &&
+			(Status == VL53L0X_ERROR_NONE); i++) {
+			if ((Mask & (1 << i)) == 0)
+				continue;
+			Status = VL53L0X_complete_single_ref_calibration(
+				pArray->Dev[i]);
+		}
+	}
+
+	/* restore the Sequence Config of every device */
+	for (i = 0; (i < pArray->NumberOfDevices) &&
+		(Status == VL53L0X_ERROR_NONE); i++) {
+		if ((Mask & (1 << i)) == 0)
+			continue;
+		Status = VL53L0X_WrByte(pArray->Dev[i],
+			VL53L0X_REG_SYSTEM_SEQUENCE_CONFIG,
+			PALDevDataGet(pArray->Dev[i], SequenceConfig));
+	}
+
+	return Status;
+}
+
+
+VL53L0X_Error VL53L0X_ArrayInit(VL53L0X_Array_t *pArray)
+{
+	VL53L0X_Error Status = VL53L0X_ERROR_NONE;
+	uint32_t SpadCount;
+	uint8_t IsApertureSpads;
+	uint8_t ValidMask = 0;
+	uint8_t RefCalibrationMask = 0;
+	uint8_t Valid;
+	uint8_t i;
+	uint8_t j;
+
+	LOG_FUNCTION_START("");
+
+	pArray->RecordUpdateMask = 0;
+
+	if ((pArray->NumberOfDevices == 0) ||
+		(pArray->NumberOfDevices > VL53L0X_ARRAY_MAX_DEVICES))
+		Status = VL53L0X_ERROR_INVALID_PARAMS;
+
+	/* two devices left on the same address can not be told apart */
+	for (i = 0; (i < pArray->NumberOfDevices) &&
+		(Status == VL53L0X_ERROR_NONE); i++)
+		for (j = i + 1; j < pArray->NumberOfDevices; j++)
+			if (pArray->DeviceAddress[i] ==
+				pArray->DeviceAddress[j])
+				Status = VL53L0X_ERROR_INVALID_PARAMS;
+
+	/* devices are released from XSHUTDOWN in index order, the one
+	 * keeping the default address must be the last, or the next one
+	 * released would boot on the same address
+	 */
+	if ((Status == VL53L0X_ERROR_NONE) && (pArray->XShut != NULL))
+		for (i = 0; i + 1 < pArray->NumberOfDevices; i++)
+			if (pArray->DeviceAddress[i] ==
+				VL53L0X_ARRAY_DEFAULT_ADDRESS)
+				Status = VL53L0X_ERROR_INVALID_PARAMS;
+
+	/* Phase 1: serial by nature, one device at a time on 0x52 */
+	if (Status == VL53L0X_ERROR_NONE)
+		Status = ArrayBootAndAddress(pArray);
+
+	/* Phase 2 and 3: every device is on its own address */
+	for (i = 0; (i < pArray->NumberOfDevices) &&
+		(Status == VL53L0X_ERROR_NONE); i++)
+		Status = VL53L0X_DataInit(pArray->Dev[i]);
+
+	for (i = 0; (i < pArray->NumberOfDevices) &&
+		(Status == VL53L0X_ERROR_NONE); i++)
+		Status = VL53L0X_StaticInit(pArray->Dev[i]);
+
+	/* Phase 4: restore what the records hold, everything else is
+	 * calibrated: VHV and phase on all devices at once, then the
+	 * reference SPADs one device at a time
+	 */
+	for (i = 0; (i < pArray->NumberOfDevices) &&
+		(Status == VL53L0X_ERROR_NONE); i++) {
+		Valid = 0;
+		if (pArray->pRecord != NULL)
+			Status = VL53L0X_CheckCalibrationRecord(
+				&pArray->pRecord[i], &Valid);
+
+		if ((Status == VL53L0X_ERROR_NONE) && (Valid == 1)) {
+			ValidMask |= (uint8_t)(1 << i);
+			Status = VL53L0X_SetCalibrationRecord(pArray->Dev[i],
+				&pArray->pRecord[i],
+				pArray->RestoreRefCalibration);
+		}
+
+		if ((Valid == 0) || (pArray->RestoreRefCalibration == 0))
+			RefCalibrationMask |= (uint8_t)(1 << i);
+	}
+
+	if ((Status == VL53L0X_ERROR_NONE) && (RefCalibrationMask != 0))
+		Status = ArrayRefCalibration(pArray, RefCalibrationMask);
+
+	for (i = 0; (i < pArray->NumberOfDevices) &&
+		(Status == VL53L0X_ERROR_NONE); i++) {
+		if (ValidMask & (1 << i))
+			continue;
+
+		Status = VL53L0X_PerformRefSpadManagement(pArray->Dev[i],
+			&SpadCount, &IsApertureSpads);
+
+		if ((Status == VL53L0X_ERROR_NONE) &&
+			(pArray->pRecord != NULL)) {
+			Status = VL53L0X_GetCalibrationRecord(pArray->Dev[i],
+				&pArray->pRecord[i]);
+			if (Status == VL53L0X_ERROR_NONE)
+				pArray->RecordUpdateMask |= (uint8_t)(1 << i);
+		}
+	}
+
+	LOG_FUNCTION_END(Status);
+	return Status;
+}
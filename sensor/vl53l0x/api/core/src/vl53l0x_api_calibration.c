@@ -1062,18 +1062,24 @@ VL53L0X_Error VL53L0X_get_reference_spads(VL53L0X_DEV Dev,
 }
 
 
-VL53L0X_Error VL53L0X_perform_single_ref_calibration(VL53L0X_DEV Dev,
+VL53L0X_Error VL53L0X_start_single_ref_calibration(VL53L0X_DEV Dev,
 		uint8_t vhv_init_byte)
 {
 	VL53L0X_Error Status = VL53L0X_ERROR_NONE;
 
-	if (Status == VL53L0X_ERROR_NONE)
-		Status = VL53L0X_WrByte(Dev, VL53L0X_REG_SYSRANGE_START,
-				VL53L0X_REG_SYSRANGE_MODE_START_STOP |
-				vhv_init_byte);
+	Status = VL53L0X_WrByte(Dev, VL53L0X_REG_SYSRANGE_START,
+			VL53L0X_REG_SYSRANGE_MODE_START_STOP |
+			vhv_init_byte);
+
+	return Status;
+}
 
-	if (Status == VL53L0X_ERROR_NONE)
-		Status = VL53L0X_measurement_poll_for_completion(Dev);
+
+VL53L0X_Error VL53L0X_complete_single_ref_calibration(VL53L0X_DEV Dev)
+{
+	VL53L0X_Error Status = VL53L0X_ERROR_NONE;
+
+	Status = VL53L0X_measurement_poll_for_completion(Dev);
 
 	if (Status == VL53L0X_ERROR_NONE)
 		Status = VL53L0X_ClearInterruptMask(Dev, 0);
@@ -1085,6 +1091,20 @@ VL53L0X_Error VL53L0X_perform_single_ref_calibration(VL53L0X_DEV Dev,
 }
 
 
+VL53L0X_Error VL53L0X_perform_single_ref_calibration(VL53L0X_DEV Dev,
+		uint8_t vhv_init_byte)
+{
+	VL53L0X_Error Status = VL53L0X_ERROR_NONE;
+
+	Status = VL53L0X_start_single_ref_calibration(Dev, vhv_init_byte);
+
+	if (Status == VL53L0X_ERROR_NONE)
+		Status = VL53L0X_complete_single_ref_calibration(Dev);
+
+	return Status;
+}
+
+
 VL53L0X_Error VL53L0X_ref_calibration_io(VL53L0X_DEV Dev, uint8_t read_not_write,
 	uint8_t VhvSettings, uint8_t PhaseCal,
 	uint8_t *pVhvSettings, uint8_t *pPhaseCal,
@@ -0,0 +1,182 @@
+/*******************************************************************************
+ Copyright  2016, STMicroelectronics International N.V.
+ All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright
+ notice, this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright
+ notice, this list of conditions and the following disclaimer in the
+ documentation and/or other materials provided with the distribution.
+ * Neither the name of STMicroelectronics nor the
+ names of its contributors may be used to endorse or promote products
+ derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, AND
+ NON-INFRINGEMENT OF INTELLECTUAL PROPERTY RIGHTS ARE DISCLAIMED.
+ IN NO EVENT SHALL STMICROELECTRONICS INTERNATIONAL N.V. BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+
+
+#include "vl53l0x_api_continuous.h"
+
+#define LOG_FUNCTION_START(fmt, ...) \
+	_LOG_FUNCTION_START(TRACE_MODULE_API, fmt, ##__VA_ARGS__)
+#define LOG_FUNCTION_END(status, ...) \
+	_LOG_FUNCTION_END(TRACE_MODULE_API, status, ##__VA_ARGS__)
+#define LOG_FUNCTION_END_FMT(status, fmt, ...) \
+	_LOG_FUNCTION_END_FMT(TRACE_MODULE_API, status, fmt, ##__VA_ARGS__)
+
+
+VL53L0X_Error VL53L0X_StartContinuousRanging(VL53L0X_DEV Dev,
+	VL53L0X_RangeRing_t *pRing,
+	uint32_t InterMeasurementPeriodMilliSeconds,
+	VL53L0X_InterruptPolarity Polarity)
+{
+	VL53L0X_Error Status = VL53L0X_ERROR_NONE;
+	VL53L0X_DeviceModes DeviceMode;
+	LOG_FUNCTION_START("");
+
+	pRing->Head = 0;
+	pRing->Tail = 0;
+	pRing->OverrunCount = 0;
+	pRing->ErrorCount = 0;
+
+	if (InterMeasurementPeriodMilliSeconds == 0)
+		DeviceMode = VL53L0X_DEVICEMODE_CONTINUOUS_RANGING;
+	else
+		DeviceMode = VL53L0X_DEVICEMODE_CONTINUOUS_TIMED_RANGING;
+
+	Status = VL53L0X_SetDeviceMode(Dev, DeviceMode);
+
+	if ((Status == VL53L0X_ERROR_NONE) &&
+		(InterMeasurementPeriodMilliSeconds != 0))
+		Status = VL53L0X_SetInterMeasurementPeriodMilliSeconds(Dev,
+			InterMeasurementPeriodMilliSeconds);
+
+	/* also clears any interrupt left pending */
+	if (Status == VL53L0X_ERROR_NONE)
+		Status = VL53L0X_SetGpioConfig(Dev, 0, DeviceMode,
+			VL53L0X_GPIOFUNCTIONALITY_NEW_MEASURE_READY, Polarity);
+
+	if (Status == VL53L0X_ERROR_NONE)
+		Status = VL53L0X_StartMeasurement(Dev);
+
+	LOG_FUNCTION_END(Status);
+	return Status;
+}
+
+
+VL53L0X_Error VL53L0X_ServiceContinuousRanging(VL53L0X_DEV Dev,
+	VL53L0X_RangeRing_t *pRing)
+{
+	VL53L0X_Error Status = VL53L0X_ERROR_NONE;
+	VL53L0X_Error ClearStatus;
+	uint32_t Head = pRing->Head;
+	uint8_t Full;
+	LOG_FUNCTION_START("");
+
+	Full = ((Head - pRing->Tail) >= VL53L0X_RANGE_RING_DEPTH) ? 1 : 0;
+
+	if (Full == 1) {
+		/* drop the newest range, Tail belongs to the reader */
+		pRing->OverrunCount++;
+	} else {
+		Status = VL53L0X_GetRangingMeasurementData(Dev,
+			&pRing->Data[Head & (VL53L0X_RANGE_RING_DEPTH - 1)]);
+	}
+
+	/* clear even after a failed read, GPIO1 would stay asserted and no
+	 * further edge would come
+	 */
+	ClearStatus = VL53L0X_WrByte(Dev,
+		VL53L0X_REG_SYSTEM_INTERRUPT_CLEAR, 0x01);
+	if (ClearStatus == VL53L0X_ERROR_NONE)
+		ClearStatus = VL53L0X_WrByte(Dev,
+			VL53L0X_REG_SYSTEM_INTERRUPT_CLEAR, 0x00);
+
+	if ((Full == 0) && (Status == VL53L0X_ERROR_NONE)) {
+		/* the slot must be complete before the reader can see it */
+		VL53L0X_RANGE_RING_BARRIER();
+		pRing->Head = Head + 1;
+	} else if (Status != VL53L0X_ERROR_NONE) {
+		pRing->ErrorCount++;
+	}
+
+	if (Status == VL53L0X_ERROR_NONE)
+		Status = ClearStatus;
+
+	LOG_FUNCTION_END(Status);
+	return Status;
+}
+
+
+VL53L0X_Error VL53L0X_RangeRingPop(VL53L0X_RangeRing_t *pRing,
+	VL53L0X_RangingMeasurementData_t *pRangingMeasurementData,
+	uint8_t *pDataAvailable)
+{
+	VL53L0X_Error Status = VL53L0X_ERROR_NONE;
+	uint32_t Tail = pRing->Tail;
+	LOG_FUNCTION_START("");
+
+	if (pRing->Head == Tail) {
+		*pDataAvailable = 0;
+	} else {
+		/* Head read before the slot */
+		VL53L0X_RANGE_RING_BARRIER();
+		*pRangingMeasurementData =
+			pRing->Data[Tail & (VL53L0X_RANGE_RING_DEPTH - 1)];
+		/* slot copied before it is handed back */
+		VL53L0X_RANGE_RING_BARRIER();
+		pRing->Tail = Tail + 1;
+		*pDataAvailable = 1;
+	}
+
+	LOG_FUNCTION_END(Status);
+	return Status;
+}
+
+
+VL53L0X_Error VL53L0X_StopContinuousRanging(VL53L0X_DEV Dev)
+{
+	VL53L0X_Error Status = VL53L0X_ERROR_NONE;
+	uint32_t StopCompleted = 1;
+	uint32_t LoopNb = 0;
+	LOG_FUNCTION_START("");
+
+	Status = VL53L0X_StopMeasurement(Dev);
+
+	while ((Status == VL53L0X_ERROR_NONE) && (StopCompleted != 0)) {
+		Status = VL53L0X_GetStopCompletedStatus(Dev, &StopCompleted);
+		if ((Status == VL53L0X_ERROR_NONE) && (StopCompleted != 0)) {
+			LoopNb++;
+			if (LoopNb >= VL53L0X_DEFAULT_MAX_LOOP)
+				Status = VL53L0X_ERROR_TIME_OUT;
+			else
+				Status = VL53L0X_PollingDelay(Dev);
+		}
+	}
+
+	/* also clears the interrupt of the last range */
+	if (Status == VL53L0X_ERROR_NONE)
+		Status = VL53L0X_SetGpioConfig(Dev, 0,
+			VL53L0X_DEVICEMODE_SINGLE_RANGING,
+			VL53L0X_GPIOFUNCTIONALITY_OFF,
+			VL53L0X_INTERRUPTPOLARITY_LOW);
+
+	if (Status == VL53L0X_ERROR_NONE)
+		Status = VL53L0X_SetDeviceMode(Dev,
+			VL53L0X_DEVICEMODE_SINGLE_RANGING);
+
+	LOG_FUNCTION_END(Status);
+	return Status;
+}
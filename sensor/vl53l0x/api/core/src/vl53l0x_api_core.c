@@ -41,6 +41,58 @@
 #define LOG_FUNCTION_END_FMT(status, fmt, ...) \
 	_LOG_FUNCTION_END_FMT(TRACE_MODULE_API, status, fmt, ##__VA_ARGS__)
 
+#if VL53L0X_FAST_MATH
+#ifndef VL53L0X_CLZ
+#if defined(__GNUC__)
+#define VL53L0X_CLZ(x) __builtin_clz(x)
+#else
+#error VL53L0X_CLZ must be defined for this compiler
+#endif
+#endif
+
+/* x / d as (x * ceil(2^n / d)) >> n, exact for any 32 bit x */
+#define VL53L0X_UDIV(x, d) VL53L0X_UDIV_##d((uint32_t)(x))
+#define VL53L0X_UDIV_RECIPROCAL(x, m, n) \
+	((uint32_t)(((uint64_t)(x) * (m)) >> (n)))
+#define VL53L0X_UDIV_6(x)     VL53L0X_UDIV_RECIPROCAL(x, 0xAAAAAAABU, 34)
+#define VL53L0X_UDIV_100(x)   VL53L0X_UDIV_RECIPROCAL(x, 0x51EB851FU, 37)
+#define VL53L0X_UDIV_1000(x)  VL53L0X_UDIV_RECIPROCAL(x, 0x10624DD3U, 38)
+#define VL53L0X_UDIV_4700(x)  VL53L0X_UDIV_RECIPROCAL(x, 0x37C67B51U, 42)
+#define VL53L0X_UDIV_10000(x) VL53L0X_UDIV_RECIPROCAL(x, 0xD1B71759U, 45)
+
+/* floor(sqrt((i + 64.5) * 2^24)): square root seed for the normalised
+ * arguments whose top byte is i + 64
+ */
+static const uint16_t isqrt_seed[192] = {
+	0x807F, 0x817D, 0x8279, 0x8374, 0x846C, 0x8562, 0x8657, 0x874A,
+	0x883C, 0x892B, 0x8A19, 0x8B06, 0x8BF1, 0x8CDA, 0x8DC2, 0x8EA9,
+	0x8F8E, 0x9071, 0x9153, 0x9234, 0x9314, 0x93F2, 0x94CF, 0x95AA,
+	0x9684, 0x975D, 0x9835, 0x990C, 0x99E2, 0x9AB6, 0x9B89, 0x9C5B,
+	0x9D2C, 0x9DFC, 0x9ECB, 0x9F99, 0xA066, 0xA132, 0xA1FC, 0xA2C6,
+	0xA38F, 0xA457, 0xA51E, 0xA5E4, 0xA6A9, 0xA76D, 0xA830, 0xA8F3,
+	0xA9B4, 0xAA75, 0xAB35, 0xABF4, 0xACB2, 0xAD6F, 0xAE2C, 0xAEE7,
+	0xAFA2, 0xB05C, 0xB116, 0xB1CF, 0xB286, 0xB33E, 0xB3F4, 0xB4AA,
+	0xB55F, 0xB613, 0xB6C7, 0xB77A, 0xB82C, 0xB8DE, 0xB98F, 0xBA3F,
+	0xBAEE, 0xBB9D, 0xBC4C, 0xBCF9, 0xBDA6, 0xBE53, 0xBEFF, 0xBFAA,
+	0xC055, 0xC0FF, 0xC1A8, 0xC251, 0xC2FA, 0xC3A1, 0xC449, 0xC4EF,
+	0xC595, 0xC63B, 0xC6E0, 0xC784, 0xC828, 0xC8CC, 0xC96F, 0xCA11,
+	0xCAB3, 0xCB55, 0xCBF5, 0xCC96, 0xCD36, 0xCDD5, 0xCE74, 0xCF13,
+	0xCFB1, 0xD04E, 0xD0EB, 0xD188, 0xD224, 0xD2C0, 0xD35B, 0xD3F6,
+	0xD490, 0xD52A, 0xD5C4, 0xD65D, 0xD6F5, 0xD78E, 0xD825, 0xD8BD,
+	0xD954, 0xD9EA, 0xDA81, 0xDB16, 0xDBAC, 0xDC41, 0xDCD5, 0xDD69,
+	0xDDFD, 0xDE91, 0xDF24, 0xDFB6, 0xE049, 0xE0DB, 0xE16C, 0xE1FD,
+	0xE28E, 0xE31F, 0xE3AF, 0xE43E, 0xE4CE, 0xE55D, 0xE5EB, 0xE67A,
+	0xE708, 0xE795, 0xE823, 0xE8B0, 0xE93C, 0xE9C9, 0xEA55, 0xEAE0,
+	0xEB6C, 0xEBF7, 0xEC82, 0xED0C, 0xED96, 0xEE20, 0xEEA9, 0xEF32,
+	0xEFBB, 0xF044, 0xF0CC, 0xF154, 0xF1DC, 0xF263, 0xF2EA, 0xF371,
+	0xF3F7, 0xF47D, 0xF503, 0xF589, 0xF60E, 0xF693, 0xF718, 0xF79C,
+	0xF821, 0xF8A4, 0xF928, 0xF9AB, 0xFA2F, 0xFAB1, 0xFB34, 0xFBB6,
+	0xFC38, 0xFCBA, 0xFD3C, 0xFDBD, 0xFE3E, 0xFEBF, 0xFF3F, 0xFFBF
+};
+#else
+#define VL53L0X_UDIV(x, d) ((uint32_t)(x) / (d))
+#endif
+
 VL53L0X_Error VL53L0X_reverse_bytes(uint8_t *data, uint32_t size)
 {
 	VL53L0X_Error Status = VL53L0X_ERROR_NONE;
@@ -122,6 +174,34 @@ uint8_t VL53L0X_encode_vcsel_period(uint8_t vcsel_period_pclks)
 
 uint32_t VL53L0X_isqrt(uint32_t num)
 {
+#if VL53L0X_FAST_MATH
+	/*
+	 * Table seeded Newton iteration
+	 *
+	 * The argument is shifted left by an even count so that its top byte
+	 * indexes the seed table. One Newton step from the seed never lands
+	 * below the root and is at most a few units above it, the result is
+	 * then corrected down to the floor.
+	 */
+
+	uint32_t  res;
+	uint8_t   shift;
+
+	if (num == 0)
+		return 0;
+
+	shift = VL53L0X_CLZ(num) & ~1;
+	res = isqrt_seed[((num << shift) >> 24) - 64] >> (shift / 2);
+	res = (res + num / res) >> 1;
+
+	if (res > 0xFFFF)
+		res = 0xFFFF;
+
+	while (res * res > num)
+		res--;
+
+	return res;
+#else
 	/*
 	 * Implements an integer square root
 	 *
@@ -149,6 +229,7 @@ uint32_t VL53L0X_isqrt(uint32_t num)
 	}
 
 	return res;
+#endif
 }
 
 
@@ -1352,14 +1433,14 @@ VL53L0X_Error VL53L0X_load_tuning_settings(VL53L0X_DEV Dev,
 		uint8_t *pTuningSettingBuffer)
 {
 	VL53L0X_Error Status = VL53L0X_ERROR_NONE;
-	int i;
 	int Index;
 	uint8_t msb;
 	uint8_t lsb;
 	uint8_t SelectParam;
 	uint8_t NumberOfWrites;
 	uint8_t Address;
-	uint8_t localBuffer[4]; /* max */
+	uint8_t Count;
+	uint16_t PageSelect = 0x100; /* not known yet */
 	uint16_t Temp16;
 
 	LOG_FUNCTION_START("");
@@ -1412,21 +1493,40 @@ VL53L0X_Error VL53L0X_load_tuning_settings(VL53L0X_DEV Dev,
 				Status = VL53L0X_ERROR_INVALID_PARAMS;
 			}
 
-		} else if (NumberOfWrites <= 4) {
+		} else {
 			Address = *(pTuningSettingBuffer + Index);
 			Index++;
 
-			for (i = 0; i < NumberOfWrites; i++) {
-				localBuffer[i] = *(pTuningSettingBuffer +
-							Index);
-				Index++;
+			if ((Address == 0xFF) && (NumberOfWrites == 1)) {
+				if (*(pTuningSettingBuffer + Index) ==
+					PageSelect) {
+					/* page already selected */
+					Index++;
+					NumberOfWrites = 0;
+				} else {
+					PageSelect =
+						*(pTuningSettingBuffer + Index);
+				}
+			} else if (Address + NumberOfWrites > 0xFF) {
+				PageSelect = 0x100;
 			}
 
-			Status = VL53L0X_WriteMulti(Dev, Address, localBuffer,
-					NumberOfWrites);
-
-		} else {
-			Status = VL53L0X_ERROR_INVALID_PARAMS;
+			/* entries are written from the table in place, split
+			 * to the platform transfer size
+			 */
+			while ((NumberOfWrites > 0) &&
+				(Status == VL53L0X_ERROR_NONE)) {
+				Count = NumberOfWrites;
+				if (Count > VL53L0X_MAX_I2C_XFER_SIZE)
+					Count = VL53L0X_MAX_I2C_XFER_SIZE;
+
+				Status = VL53L0X_WriteMulti(Dev, Address,
+					pTuningSettingBuffer + Index, Count);
+
+				Address += Count;
+				Index += Count;
+				NumberOfWrites -= Count;
+			}
 		}
 	}
 
@@ -1579,8 +1679,9 @@ VL53L0X_Error VL53L0X_calc_dmax(
 	 * a very small dmax.
 	 */
 	sigmaEstP2Tmp = (sigmaEstimateP2 + 0x8000) >> 16;
-	sigmaEstP2Tmp = (sigmaEstP2Tmp + cAmbEffWidthSigmaEst_ns/2)/
-		cAmbEffWidthSigmaEst_ns;
+	/* divide by cAmbEffWidthSigmaEst_ns */
+	sigmaEstP2Tmp = VL53L0X_UDIV(sigmaEstP2Tmp +
+		cAmbEffWidthSigmaEst_ns/2, 6);
 	sigmaEstP2Tmp *= cAmbEffWidthDMax_ns;
 
 	if (sigmaEstP2Tmp > 0xffff) {
@@ -1591,8 +1692,8 @@ VL53L0X_Error VL53L0X_calc_dmax(
 		 * correction.
 		 * Perform division before multiplication to prevent overflow.
 		 */
-		sigmaEstimateP2 = (sigmaEstimateP2 + cAmbEffWidthSigmaEst_ns/2)/
-			cAmbEffWidthSigmaEst_ns;
+		sigmaEstimateP2 = VL53L0X_UDIV(sigmaEstimateP2 +
+			cAmbEffWidthSigmaEst_ns/2, 6);
 		sigmaEstimateP2 *= cAmbEffWidthDMax_ns;
 
 		/* FixPoint1616 >> 16 = uint32 */
@@ -1647,10 +1748,10 @@ VL53L0X_Error VL53L0X_calc_dmax(
 	 * handle the larger and smaller elements of this equation,
 	 * i.e. speed of light and pulse widths.
 	 */
-	minSignalNeeded = (minSignalNeeded + 500) / 1000;
+	minSignalNeeded = VL53L0X_UDIV(minSignalNeeded + 500, 1000);
 	minSignalNeeded <<= 4;
 
-	minSignalNeeded = (minSignalNeeded + 500) / 1000;
+	minSignalNeeded = VL53L0X_UDIV(minSignalNeeded + 500, 1000);
 
 	/* FixPoint1616 >> 8 = FixPoint2408 */
 	signalLimitTmp = (cSignalLimit + 0x80) >> 8;
@@ -1683,6 +1784,111 @@ VL53L0X_Error VL53L0X_calc_dmax(
 }
 
 
+VL53L0X_Error VL53L0X_get_sigma_constants(VL53L0X_DEV Dev,
+	uint32_t *pPeakVcselDuration_us, FixPoint1616_t *pSigmaEstRef)
+{
+	const FixPoint1616_t cDfltFinalRangeIntegrationTimeMilliSecs	= 0x00190000; /* 25ms */
+	const uint32_t cPllPeriod_ps			= 1655;
+
+	VL53L0X_SigmaConstants_t SigmaConstants;
+	uint32_t finalRangeTimeoutMicroSecs;
+	uint32_t preRangeTimeoutMicroSecs;
+	uint32_t finalRangeIntegrationTimeMilliSecs;
+	uint32_t vcselWidth;
+	uint32_t finalRangeMacroPCLKS;
+	uint32_t preRangeMacroPCLKS;
+	uint32_t peakVcselDuration_us;
+	FixPoint1616_t sigmaEstRef;
+	uint8_t finalRangeVcselPCLKS;
+	uint8_t preRangeVcselPCLKS;
+	VL53L0X_Error Status = VL53L0X_ERROR_NONE;
+
+	LOG_FUNCTION_START("");
+
+	SigmaConstants = VL53L0X_GETDEVICESPECIFICPARAMETER(Dev,
+		SigmaConstants);
+
+	finalRangeTimeoutMicroSecs = VL53L0X_GETDEVICESPECIFICPARAMETER(
+		Dev, FinalRangeTimeoutMicroSecs);
+	finalRangeVcselPCLKS = VL53L0X_GETDEVICESPECIFICPARAMETER(
+		Dev, FinalRangeVcselPulsePeriod);
+	preRangeTimeoutMicroSecs = VL53L0X_GETDEVICESPECIFICPARAMETER(
+		Dev, PreRangeTimeoutMicroSecs);
+	preRangeVcselPCLKS = VL53L0X_GETDEVICESPECIFICPARAMETER(
+		Dev, PreRangeVcselPulsePeriod);
+
+	/* the terms only depend on the timing configuration, recompute them
+	 * when any of it has changed since the last call
+	 */
+	if ((SigmaConstants.Valid == 0) ||
+		(SigmaConstants.FinalRangeTimeoutMicroSecs !=
+			finalRangeTimeoutMicroSecs) ||
+		(SigmaConstants.FinalRangeVcselPulsePeriod !=
+			finalRangeVcselPCLKS) ||
+		(SigmaConstants.PreRangeTimeoutMicroSecs !=
+			preRangeTimeoutMicroSecs) ||
+		(SigmaConstants.PreRangeVcselPulsePeriod !=
+			preRangeVcselPCLKS)) {
+
+		/* Calculate final range macro periods */
+		finalRangeMacroPCLKS = VL53L0X_calc_timeout_mclks(
+			Dev, finalRangeTimeoutMicroSecs, finalRangeVcselPCLKS);
+
+		/* Calculate pre-range macro periods */
+		preRangeMacroPCLKS = VL53L0X_calc_timeout_mclks(
+			Dev, preRangeTimeoutMicroSecs, preRangeVcselPCLKS);
+
+		vcselWidth = 3;
+		if (finalRangeVcselPCLKS == 8)
+			vcselWidth = 2;
+
+
+		peakVcselDuration_us = vcselWidth * 2048 *
+			(preRangeMacroPCLKS + finalRangeMacroPCLKS);
+		peakVcselDuration_us = (peakVcselDuration_us + 500)/1000;
+		peakVcselDuration_us *= cPllPeriod_ps;
+		peakVcselDuration_us = (peakVcselDuration_us + 500)/1000;
+
+		finalRangeIntegrationTimeMilliSecs =
+			(finalRangeTimeoutMicroSecs + preRangeTimeoutMicroSecs + 500)/1000;
+
+		/* below 0.5 ms, only possible before the timeouts are set */
+		if (finalRangeIntegrationTimeMilliSecs == 0)
+			finalRangeIntegrationTimeMilliSecs = 1;
+
+		/* sigmaEstRef = 1mm * 25ms/final range integration time (inc pre-range)
+		 * sqrt(FixPoint1616/int) = FixPoint2408)
+		 */
+		sigmaEstRef =
+			VL53L0X_isqrt((cDfltFinalRangeIntegrationTimeMilliSecs +
+				finalRangeIntegrationTimeMilliSecs/2)/
+				finalRangeIntegrationTimeMilliSecs);
+
+		/* FixPoint2408 << 8 = FixPoint1616 */
+		sigmaEstRef <<= 8;
+		sigmaEstRef = (sigmaEstRef + 500)/1000;
+
+		SigmaConstants.Valid = 1;
+		SigmaConstants.FinalRangeTimeoutMicroSecs =
+			finalRangeTimeoutMicroSecs;
+		SigmaConstants.FinalRangeVcselPulsePeriod = finalRangeVcselPCLKS;
+		SigmaConstants.PreRangeTimeoutMicroSecs =
+			preRangeTimeoutMicroSecs;
+		SigmaConstants.PreRangeVcselPulsePeriod = preRangeVcselPCLKS;
+		SigmaConstants.PeakVcselDurationMicroSecs = peakVcselDuration_us;
+		SigmaConstants.SigmaEstRef = sigmaEstRef;
+
+		VL53L0X_SETDEVICESPECIFICPARAMETER(Dev, SigmaConstants,
+			SigmaConstants);
+	}
+
+	*pPeakVcselDuration_us = SigmaConstants.PeakVcselDurationMicroSecs;
+	*pSigmaEstRef = SigmaConstants.SigmaEstRef;
+
+	LOG_FUNCTION_END(Status);
+	return Status;
+}
+
 VL53L0X_Error VL53L0X_calc_sigma_estimate(VL53L0X_DEV Dev,
 	VL53L0X_RangingMeasurementData_t *pRangingMeasurementData,
 	FixPoint1616_t *pSigmaEstimate,
@@ -1692,8 +1898,6 @@ VL53L0X_Error VL53L0X_calc_sigma_estimate(VL53L0X_DEV Dev,
 	const uint32_t cPulseEffectiveWidth_centi_ns   = 800;
 	/* Expressed in 100ths of a ns, i.e. centi-ns */
 	const uint32_t cAmbientEffectiveWidth_centi_ns = 600;
-	const FixPoint1616_t cDfltFinalRangeIntegrationTimeMilliSecs	= 0x00190000; /* 25ms */
-	const uint32_t cVcselPulseWidth_ps	= 4700; /* pico secs */
 	const FixPoint1616_t cSigmaEstMax	= 0x028F87AE;
 	const FixPoint1616_t cSigmaEstRtnMax	= 0xF000;
 	const FixPoint1616_t cAmbToSignalRatioMax = 0xF0000000/
@@ -1702,12 +1906,8 @@ VL53L0X_Error VL53L0X_calc_sigma_estimate(VL53L0X_DEV Dev,
 	const FixPoint1616_t cTOF_per_mm_ps		= 0x0006999A;
 	const uint32_t c16BitRoundingParam		= 0x00008000;
 	const FixPoint1616_t cMaxXTalk_kcps		= 0x00320000;
-	const uint32_t cPllPeriod_ps			= 1655;
 
 	uint32_t vcselTotalEventsRtn;
-	uint32_t finalRangeTimeoutMicroSecs;
-	uint32_t preRangeTimeoutMicroSecs;
-	uint32_t finalRangeIntegrationTimeMilliSecs;
 	FixPoint1616_t sigmaEstimateP1;
 	FixPoint1616_t sigmaEstimateP2;
 	FixPoint1616_t sigmaEstimateP3;
@@ -1731,12 +1931,7 @@ VL53L0X_Error VL53L0X_calc_sigma_estimate(VL53L0X_DEV Dev,
 	FixPoint1616_t totalSignalRate_mcps;
 	FixPoint1616_t correctedSignalRate_mcps;
 	FixPoint1616_t sigmaEstRef;
-	uint32_t vcselWidth;
-	uint32_t finalRangeMacroPCLKS;
-	uint32_t preRangeMacroPCLKS;
 	uint32_t peakVcselDuration_us;
-	uint8_t finalRangeVcselPCLKS;
-	uint8_t preRangeVcselPCLKS;
 	/*! \addtogroup calc_sigma_estimate
 	 * @{
 	 *
@@ -1777,38 +1972,12 @@ VL53L0X_Error VL53L0X_calc_sigma_estimate(VL53L0X_DEV Dev,
 	if (xTalkCompRate_kcps > cMaxXTalk_kcps)
 		xTalkCompRate_kcps = cMaxXTalk_kcps;
 
-	if (Status == VL53L0X_ERROR_NONE) {
-
-		/* Calculate final range macro periods */
-		finalRangeTimeoutMicroSecs = VL53L0X_GETDEVICESPECIFICPARAMETER(
-			Dev, FinalRangeTimeoutMicroSecs);
-
-		finalRangeVcselPCLKS = VL53L0X_GETDEVICESPECIFICPARAMETER(
-			Dev, FinalRangeVcselPulsePeriod);
-
-		finalRangeMacroPCLKS = VL53L0X_calc_timeout_mclks(
-			Dev, finalRangeTimeoutMicroSecs, finalRangeVcselPCLKS);
-
-		/* Calculate pre-range macro periods */
-		preRangeTimeoutMicroSecs = VL53L0X_GETDEVICESPECIFICPARAMETER(
-			Dev, PreRangeTimeoutMicroSecs);
-
-		preRangeVcselPCLKS = VL53L0X_GETDEVICESPECIFICPARAMETER(
-			Dev, PreRangeVcselPulsePeriod);
-
-		preRangeMacroPCLKS = VL53L0X_calc_timeout_mclks(
-			Dev, preRangeTimeoutMicroSecs, preRangeVcselPCLKS);
-
-		vcselWidth = 3;
-		if (finalRangeVcselPCLKS == 8)
-			vcselWidth = 2;
-
+	/* timing terms, cached per timing configuration */
+	if (Status == VL53L0X_ERROR_NONE)
+		Status = VL53L0X_get_sigma_constants(Dev,
+			&peakVcselDuration_us, &sigmaEstRef);
 
-		peakVcselDuration_us = vcselWidth * 2048 *
-			(preRangeMacroPCLKS + finalRangeMacroPCLKS);
-		peakVcselDuration_us = (peakVcselDuration_us + 500)/1000;
-		peakVcselDuration_us *= cPllPeriod_ps;
-		peakVcselDuration_us = (peakVcselDuration_us + 500)/1000;
+	if (Status == VL53L0X_ERROR_NONE) {
 
 		/* Fix1616 >> 8 = Fix2408 */
 		totalSignalRate_mcps = (totalSignalRate_mcps + 0x80) >> 8;
@@ -1861,11 +2030,12 @@ VL53L0X_Error VL53L0X_calc_sigma_estimate(VL53L0X_DEV Dev,
 		 * 500 is added to ensure rounding when integer division
 		 * truncates.
 		 */
-		diff1_mcps = (((peakSignalRate_kcps << 16) -
-			2 * xTalkCompRate_kcps) + 500)/1000;
+		diff1_mcps = VL53L0X_UDIV(((peakSignalRate_kcps << 16) -
+			2 * xTalkCompRate_kcps) + 500, 1000);
 
 		/* vcselRate + xtalkCompRate */
-		diff2_mcps = ((peakSignalRate_kcps << 16) + 500)/1000;
+		diff2_mcps = VL53L0X_UDIV((peakSignalRate_kcps << 16) + 500,
+			1000);
 
 		/* Shift by 8 bits to increase resolution prior to the
 		 * division */
@@ -1880,8 +2050,9 @@ VL53L0X_Error VL53L0X_calc_sigma_estimate(VL53L0X_DEV Dev,
 		if(pRangingMeasurementData->RangeStatus != 0){
 			pwMult = 1 << 16;
 		} else {
-			/* FixPoint1616/uint32 = FixPoint1616 */
-			pwMult = deltaT_ps/cVcselPulseWidth_ps; /* smaller than 1.0f */
+			/* FixPoint1616/uint32 = FixPoint1616, over the 4700 pico
+			 * secs vcsel pulse width */
+			pwMult = VL53L0X_UDIV(deltaT_ps, 4700); /* smaller than 1.0f */
 
 			/*
 			 * FixPoint1616 * FixPoint1616 = FixPoint3232, however both
@@ -1940,34 +2111,19 @@ VL53L0X_Error VL53L0X_calc_sigma_estimate(VL53L0X_DEV Dev,
 		 * seconds (2997) Therefore to get mm/ns we have to divide by
 		 * 10000
 		 */
-		sigmaEstRtn = (((sqrtResult_centi_ns+50)/100) /
+		sigmaEstRtn = (VL53L0X_UDIV(sqrtResult_centi_ns+50, 100) /
 				sigmaEstimateP3);
 		sigmaEstRtn		 *= VL53L0X_SPEED_OF_LIGHT_IN_AIR;
 
 		/* Add 5000 before dividing by 10000 to ensure rounding. */
 		sigmaEstRtn		 += 5000;
-		sigmaEstRtn		 /= 10000;
+		sigmaEstRtn		 = VL53L0X_UDIV(sigmaEstRtn, 10000);
 
 		if (sigmaEstRtn > cSigmaEstRtnMax) {
 			/* Clip to prevent overflow. Will ensure safe
 			 * max result. */
 			sigmaEstRtn = cSigmaEstRtnMax;
 		}
-		finalRangeIntegrationTimeMilliSecs =
-			(finalRangeTimeoutMicroSecs + preRangeTimeoutMicroSecs + 500)/1000;
-
-		/* sigmaEstRef = 1mm * 25ms/final range integration time (inc pre-range)
-		 * sqrt(FixPoint1616/int) = FixPoint2408)
-		 */
-		sigmaEstRef =
-			VL53L0X_isqrt((cDfltFinalRangeIntegrationTimeMilliSecs +
-				finalRangeIntegrationTimeMilliSecs/2)/
-				finalRangeIntegrationTimeMilliSecs);
-
-		/* FixPoint2408 << 8 = FixPoint1616 */
-		sigmaEstRef <<= 8;
-		sigmaEstRef = (sigmaEstRef + 500)/1000;
-
 		/* FixPoint1616 * FixPoint1616 = FixPoint3232 */
 		sqr1 = sigmaEstRtn * sigmaEstRtn;
 		/* FixPoint1616 * FixPoint1616 = FixPoint3232 */
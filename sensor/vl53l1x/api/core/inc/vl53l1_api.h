@@ -651,6 +651,53 @@ VL53L1_Error VL53L1_SetUserROI(VL53L1_DEV Dev,
 VL53L1_Error VL53L1_GetUserROI(VL53L1_DEV Dev,
 		VL53L1_UserRoi_t *pUserROi);
 
+/**
+ * @brief Set the list of ROIs scanned by the zone sequencer
+ *
+ * @par Function Description
+ * Validates each ROI as @a VL53L1_SetUserROI() does and precomputes its
+ * register image. The first zone is programmed so that the next
+ * @a VL53L1_StartMeasurement() ranges it. Frames are then collected with
+ * @a VL53L1_GetZoneScanFrame(). NumberOfRoi = 0, or a rejected list,
+ * disables the sequencer and restores the user ROI that was set when it
+ * was enabled.
+ *
+ * @note This function must be called after @a VL53L1_SetPresetMode()
+ * and before @a VL53L1_StartMeasurement(). Only the timed preset modes
+ * are supported: in back to back mode a new ROI applies one range late.
+ * @note This function doesn't Access to the device
+ *
+ * @param   Dev                   Device Handle
+ * @param   pRoiConfig            Pointer to the zone list, up to
+ * VL53L1_MAX_SCAN_ZONES zones
+ * @return  VL53L1_ERROR_NONE            Success
+ * @return  VL53L1_ERROR_INVALID_PARAMS  A ROI is not valid
+ * @return  VL53L1_ERROR_INVALID_COMMAND Back to back measurement mode
+ */
+VL53L1_Error VL53L1_SetZoneScanConfig(VL53L1_DEV Dev,
+		VL53L1_RoiConfig_t *pRoiConfig);
+
+/**
+ * @brief Range all the zones once and return the depth frame
+ *
+ * @par Function Description
+ * For each zone: waits for the range, reads it, then loads the next zone
+ * ROI and clears the interrupt. The ROI change is part of the handshake
+ * burst so ranging is never stopped between zones.
+ * Ranging must have been started with @a VL53L1_StartMeasurement().
+ *
+ * @note This function Access to the device
+ *
+ * @param   Dev                   Device Handle
+ * @param   pFrame                Pointer to the output frame
+ * @return  VL53L1_ERROR_NONE            Success
+ * @return  VL53L1_ERROR_INVALID_COMMAND Sequencer not configured,
+ * ranging not started or back to back measurement mode
+ * @return  "Other error code"           See ::VL53L1_Error
+ */
+VL53L1_Error VL53L1_GetZoneScanFrame(VL53L1_DEV Dev,
+		VL53L1_ZoneScanFrame_t *pFrame);
+
 /** @} VL53L1_ROI_group */
 
 /* \internal */
@@ -833,6 +880,28 @@ VL53L1_Error VL53L1_GetMeasurementDataReady(VL53L1_DEV Dev,
  */
 VL53L1_Error VL53L1_WaitMeasurementDataReady(VL53L1_DEV Dev);
 
+/**
+ * @brief Install the range completion interrupt hook.
+ *
+ * @par Function Description
+ * Once installed, @a VL53L1_WaitMeasurementDataReady() blocks in WaitFunc
+ * (typically taking a semaphore given by the GPIO1 ISR) instead of polling
+ * the interrupt status register every
+ * VL53L1_POLLING_DELAY_MS. A single register read confirms each event.
+ * WaitFunc may return VL53L1_ERROR_NOT_IMPLEMENTED to fall back to polling.
+ * Pass NULL to restore polling.
+ *
+ * @note This function must be called after @a VL53L1_DataInit().
+ * @note This function doesn't Access to the device
+ *
+ * @param   Dev      Device Handle
+ * @param   WaitFunc Blocking wait function, NULL to disable
+ * @param   pCtx     Platform context passed back to WaitFunc
+ * @return  VL53L1_ERROR_NONE        Success
+ */
+VL53L1_Error VL53L1_SetInterruptHook(VL53L1_DEV Dev,
+	VL53L1_WaitInterruptFunc WaitFunc, void *pCtx);
+
 
 /**
  * @brief Retrieve the measurements from device for a given setup
@@ -861,6 +930,42 @@ VL53L1_Error VL53L1_WaitMeasurementDataReady(VL53L1_DEV Dev);
 VL53L1_Error VL53L1_GetRangingMeasurementData(VL53L1_DEV Dev,
 	VL53L1_RangingMeasurementData_t *pRangingMeasurementData);
 
+/**
+ * @brief Select the results read back by the ranging measurement functions
+ *
+ * @par Function Description
+ * VL53L1_DEVICERESULTSLEVEL_FULL (default) reads system, core and debug
+ * results (134 bytes) on every range.
+ * VL53L1_DEVICERESULTSLEVEL_SIMPLE only reads the range, status, signal,
+ * ambient, sigma and SPAD registers (24 bytes) and skips the clearing of
+ * the output structure: every field of
+ * @a VL53L1_RangingMeasurementData_t is still filled.
+ * The first range of the low power autonomous mode is always read at
+ * full level.
+ *
+ * @note This function doesn't Access to the device
+ *
+ * @param   Dev                   Device Handle
+ * @param   ResultsLevel          VL53L1_DEVICERESULTSLEVEL_SIMPLE or
+ * VL53L1_DEVICERESULTSLEVEL_FULL
+ * @return  VL53L1_ERROR_NONE            Success
+ * @return  VL53L1_ERROR_INVALID_PARAMS  Unsupported level
+ */
+VL53L1_Error VL53L1_SetRangingResultsLevel(VL53L1_DEV Dev,
+	VL53L1_DeviceResultsLevel ResultsLevel);
+
+/**
+ * @brief Get the results level used by the ranging measurement functions
+ *
+ * @note This function doesn't Access to the device
+ *
+ * @param   Dev                   Device Handle
+ * @param   pResultsLevel         Pointer to the current level
+ * @return  VL53L1_ERROR_NONE            Success
+ */
+VL53L1_Error VL53L1_GetRangingResultsLevel(VL53L1_DEV Dev,
+	VL53L1_DeviceResultsLevel *pResultsLevel);
+
 
 
 /** @} VL53L1_measurement_group */
@@ -1079,6 +1184,79 @@ VL53L1_Error VL53L1_SetCalibrationData(VL53L1_DEV Dev,
 VL53L1_Error VL53L1_GetCalibrationData(VL53L1_DEV Dev,
 		VL53L1_CalibrationData_t  *pCalibrationData);
 
+/**
+ * @brief Serializes the Calibration Data into a blob for non volatile storage
+ *
+ * @par Function Description
+ * The blob holds a 16 byte header (magic, calibration struct version,
+ * payload size, flags and a CRC-32, MS byte first) followed by the
+ * @a VL53L1_CalibrationData_t returned by @a VL53L1_GetCalibrationData().
+ * The payload is the struct as laid out in memory, host byte order and
+ * compiler padding (zeroed), so a blob is only portable between builds
+ * with the same struct layout.
+ * The crosstalk compensation enable state is kept in the flags.
+ * Call it once the calibration functions have been run and store the
+ * VL53L1_CALIBRATION_BLOB_SIZE bytes.
+ *
+ * @note This function doesn't Accesses the device
+ *
+ * @param   Dev                          Device Handle
+ * @param   pBlob                        Buffer receiving the blob
+ * @param   BlobSize                     Size of pBlob in bytes
+ * @return  VL53L1_ERROR_NONE            Success
+ * @return  VL53L1_ERROR_BUFFER_TOO_SMALL BlobSize is below
+ * VL53L1_CALIBRATION_BLOB_SIZE
+ * @return  "Other error code"           See ::VL53L1_Error
+ */
+VL53L1_Error VL53L1_GetCalibrationBlob(VL53L1_DEV Dev,
+		uint8_t *pBlob, uint32_t BlobSize);
+
+/**
+ * @brief Restores the Calibration Data from a blob
+ *
+ * @par Function Description
+ * The header is checked before anything is applied: a blob with a wrong
+ * magic, struct version, payload size or CRC leaves the device untouched.
+ *
+ * @note This function doesn't Accesses the device
+ *
+ * @param   Dev                          Device Handle
+ * @param   pBlob                        Blob built by
+ * @a VL53L1_GetCalibrationBlob()
+ * @param   BlobSize                     Size of pBlob in bytes
+ * @return  VL53L1_ERROR_NONE            Success
+ * @return  VL53L1_ERROR_CALIBRATION_BLOB_INVALID The blob is not valid for
+ * this driver
+ * @return  "Other error code"           See ::VL53L1_Error
+ */
+VL53L1_Error VL53L1_SetCalibrationBlob(VL53L1_DEV Dev,
+		uint8_t *pBlob, uint32_t BlobSize);
+
+/**
+ * @brief Warm boot: device initialization restoring a calibration blob
+ *
+ * @par Function Description
+ * Runs @a VL53L1_DataInit() and @a VL53L1_StaticInit(), then restores
+ * the blob with @a VL53L1_SetCalibrationBlob(). When the blob is valid the
+ * device is ready to range and the reference SPAD, offset and crosstalk
+ * calibrations do not need to be run again.
+ * When it is not (first boot, corrupted storage, driver update) the device
+ * is still initialized and VL53L1_ERROR_CALIBRATION_BLOB_INVALID is
+ * returned: the caller then runs the calibrations and saves a new blob.
+ *
+ * @note This function Access to the device
+ *
+ * @param   Dev                          Device Handle
+ * @param   pBlob                        Stored blob, may be NULL
+ * @param   BlobSize                     Size of pBlob in bytes
+ * @return  VL53L1_ERROR_NONE            Success, calibration restored
+ * @return  VL53L1_ERROR_CALIBRATION_BLOB_INVALID Initialized, calibration
+ * must be run
+ * @return  "Other error code"           See ::VL53L1_Error
+ */
+VL53L1_Error VL53L1_DataInitWithCalibrationBlob(VL53L1_DEV Dev,
+		uint8_t *pBlob, uint32_t BlobSize);
+
 /**
  * @brief Gets the optical center.
  *
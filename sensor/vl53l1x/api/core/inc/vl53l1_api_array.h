@@ -0,0 +1,172 @@
+/* SPDX-License-Identifier: GPL-2.0+ OR BSD-3-Clause */
+/******************************************************************************
+ This file is part of VL53L1 and is dual licensed,
+ either GPL-2.0+
+ or 'BSD 3-clause "New" or "Revised" License' , at your option.
+ ******************************************************************************
+ */
+
+/**
+ * @file  vl53l1_api_array.h
+ *
+ * @brief Multi-device (sensor array) management on a shared I2C bus
+ */
+
+#ifndef _VL53L1_API_ARRAY_H_
+#define _VL53L1_API_ARRAY_H_
+
+#include "vl53l1_api.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/** @defgroup VL53L1_array_group VL53L1 Sensor Array Functions
+ *  @brief    Boot, start and read up to VL53L1_ARRAY_MAX_DEVICES sensors
+ *            sharing one I2C bus
+ *  @{
+ */
+
+#ifndef VL53L1_ARRAY_MAX_DEVICES
+#define VL53L1_ARRAY_MAX_DEVICES 8
+/*!< Maximum number of devices handled by one array */
+#endif
+
+#if VL53L1_ARRAY_MAX_DEVICES > 8
+#error VL53L1_ARRAY_MAX_DEVICES must be at most 8, masks are 8 bit
+#endif
+
+#define VL53L1_ARRAY_DEFAULT_ADDRESS 0x52
+/*!< 8-bit I2C address of a device coming out of XSHUTDOWN */
+
+/** @brief Drives the XSHUTDOWN pin of device Index (0 = reset, 1 = run)
+ */
+typedef VL53L1_Error (*VL53L1_ArrayXShutFunc)(void *pCtx, uint8_t Index,
+	uint8_t Level);
+
+/** @brief Updates the platform handle of device Index to a new 8-bit I2C
+ *         address (the device itself is readdressed by the array manager)
+ */
+typedef VL53L1_Error (*VL53L1_ArraySetAddressFunc)(void *pCtx,
+	uint8_t Index, uint8_t DeviceAddress);
+
+/** @brief Sensor array description and state
+ */
+typedef struct {
+
+	uint8_t   NumberOfDevices;
+	/*!< Number of devices in use, up to VL53L1_ARRAY_MAX_DEVICES */
+	VL53L1_DEV Dev[VL53L1_ARRAY_MAX_DEVICES];
+	/*!< Device handles, in start (and readout) order */
+	uint8_t   DeviceAddress[VL53L1_ARRAY_MAX_DEVICES];
+	/*!< 8-bit I2C address assigned to each device, all distinct, only
+	 * the last device may keep the default address when XShut is set */
+	uint32_t  TimingBudgetMicroSeconds;
+	/*!< Timing budget applied to every device */
+	uint32_t  InterMeasurementPeriodMilliSeconds;
+	/*!< Frame period, at least timing budget + 4 ms */
+	uint32_t  StaggerMicroSeconds;
+	/*!< Delay between the start of two consecutive devices */
+	VL53L1_ArrayXShutFunc      XShut;
+	/*!< Platform XSHUTDOWN control, NULL if devices are already up */
+	VL53L1_ArraySetAddressFunc SetAddress;
+	/*!< Platform address update, NULL if devices are already addressed */
+	void     *pCtx;
+	/*!< Platform context passed back to XShut and SetAddress */
+
+	uint32_t  FrameCount;
+	/*!< Number of frames gathered since VL53L1_ArrayStart() */
+
+} VL53L1_Array_t;
+
+/** @brief Aggregated frame of ranges, one entry per device
+ */
+typedef struct {
+
+	uint32_t  FrameCount;     /*!< Frame sequence number */
+	uint8_t   ValidMask;      /*!< Bit n set when device n returned data */
+	int16_t   RangeMilliMeter[VL53L1_ARRAY_MAX_DEVICES];
+	/*!< Range per device in mm */
+	uint8_t   RangeStatus[VL53L1_ARRAY_MAX_DEVICES];
+	/*!< Range status per device, see VL53L1_define_RangeStatus_group */
+
+} VL53L1_ArrayFrame_t;
+
+
+/**
+ * @brief Boot and initialise every device of the array
+ *
+ * @par Function Description
+ * Runs the bring-up in phases over all the devices rather than device by
+ * device: release from XSHUTDOWN, boot wait and readdressing (serial,
+ * every device boots on the default address), then
+ * @a VL53L1_DataInit(), @a VL53L1_StaticInit() and finally the timing
+ * budget and inter measurement period.
+ *
+ * @note This function Access to the device
+ *
+ * @param   pArray                Pointer to the array description
+ * @return  VL53L1_ERROR_NONE            Success
+ * @return  VL53L1_ERROR_INVALID_PARAMS  Bad device count, period or
+ *                                      addresses
+ * @return  "Other error code"           See ::VL53L1_Error
+ */
+VL53L1_Error VL53L1_ArrayInit(VL53L1_Array_t *pArray);
+
+/**
+ * @brief Start ranging on every device, staggered
+ *
+ * @par Function Description
+ * Devices are started in array order, StaggerMicroSeconds apart, so their
+ * ranges (and interrupts) complete one after the other within the same
+ * inter measurement period. A stagger of one readout slot keeps the whole
+ * frame within one timing budget; a stagger of at least the timing budget
+ * fully separates the emission of sensors with overlapping fields of view.
+ *
+ * @note This function Access to the device
+ *
+ * @param   pArray                Pointer to the array description
+ * @return  VL53L1_ERROR_NONE            Success
+ * @return  "Other error code"           See ::VL53L1_Error
+ */
+VL53L1_Error VL53L1_ArrayStart(VL53L1_Array_t *pArray);
+
+/**
+ * @brief Gather one range from every device
+ *
+ * @par Function Description
+ * Devices are read in start order, which is also their completion order,
+ * so each device costs one wait (interrupt driven when a hook is
+ * installed with @a VL53L1_SetInterruptHook()), one result read and the
+ * interrupt clear: no device is polled while another one is pending.
+ *
+ * @note This function Access to the device
+ *
+ * @param   pArray                Pointer to the array description
+ * @param   pFrame                Pointer to the aggregated frame
+ * @return  VL53L1_ERROR_NONE            Success
+ * @return  "Other error code"           See ::VL53L1_Error, first error
+ * met; the devices that answered are flagged in ValidMask
+ */
+VL53L1_Error VL53L1_ArrayGetFrame(VL53L1_Array_t *pArray,
+	VL53L1_ArrayFrame_t *pFrame);
+
+/**
+ * @brief Stop ranging on every device
+ *
+ * @note This function Access to the device
+ *
+ * @param   pArray                Pointer to the array description
+ * @return  VL53L1_ERROR_NONE            Success
+ * @return  "Other error code"           See ::VL53L1_Error
+ */
+VL53L1_Error VL53L1_ArrayStop(VL53L1_Array_t *pArray);
+
+/** @} VL53L1_array_group */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _VL53L1_API_ARRAY_H_ */
@@ -702,12 +702,16 @@ VL53L1_Error VL53L1_stop_range(
  *  - System Results
  *     - only system results are read back
  *     - only the system_results structure is updated in this case
+ *  - Simple
+ *     - only the stream 0 range, status, rate and sigma registers are
+ *       read back (24 bytes), the stream 1 system results are zeroed
  *
  * @param[in]   Dev                   : Device Handle
  * @param[in]   device_result_level   : Options: \n
  *                                      VL53L1_DEVICERESULTSLEVEL_FULL \n
  *                                      VL53L1_DEVICERESULTSLEVEL_UPTO_CORE \n
- *                                      VL53L1_DEVICERESULTSLEVEL_SYSTEM_RESULTS
+ *                                      VL53L1_DEVICERESULTSLEVEL_SYSTEM_RESULTS \n
+ *                                      VL53L1_DEVICERESULTSLEVEL_SIMPLE
  *
  * @return  VL53L1_ERROR_NONE     Success
  * @return  "Other error code"    See ::VL53L1_Error
@@ -735,7 +739,8 @@ VL53L1_Error VL53L1_get_measurement_results(
  * @param[in]   device_result_level  : Options: \n
  *                                      VL53L1_DEVICERESULTSLEVEL_FULL \n
  *                                      VL53L1_DEVICERESULTSLEVEL_UPTO_CORE \n
- *                                      VL53L1_DEVICERESULTSLEVEL_SYSTEM_RESULTS
+ *                                      VL53L1_DEVICERESULTSLEVEL_SYSTEM_RESULTS \n
+ *                                      VL53L1_DEVICERESULTSLEVEL_SIMPLE
  * @param[out]  prange_results      : pointer to VL53L1_range_results_t
 
  *
@@ -0,0 +1,121 @@
+/* SPDX-License-Identifier: GPL-2.0+ OR BSD-3-Clause */
+/******************************************************************************
+ This file is part of VL53L1 and is dual licensed,
+ either GPL-2.0+
+ or 'BSD 3-clause "New" or "Revised" License' , at your option.
+ ******************************************************************************
+ */
+
+/**
+ * @file  vl53l1_api_filter.h
+ *
+ * @brief Streaming temporal filter for ranging results
+ */
+
+#ifndef _VL53L1_API_FILTER_H_
+#define _VL53L1_API_FILTER_H_
+
+#include "vl53l1_api.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/** @defgroup VL53L1_filter_group VL53L1 Range Filter Functions
+ *  @brief    Sigma weighted, status aware temporal filtering of the
+ *            results of @a VL53L1_GetRangingMeasurementData()
+ *  @{
+ */
+
+#ifndef VL53L1_FILTER_DEPTH
+#define VL53L1_FILTER_DEPTH 8
+/*!< Number of past ranges kept per sensor (power of two, up to 32) */
+#endif
+
+#if (VL53L1_FILTER_DEPTH & (VL53L1_FILTER_DEPTH - 1)) != 0 || \
+	VL53L1_FILTER_DEPTH > 32
+#error VL53L1_FILTER_DEPTH must be a power of two up to 32
+#endif
+
+/** @brief Per-sensor filter state
+ */
+typedef struct {
+
+	int16_t   RangeMilliMeter[VL53L1_FILTER_DEPTH];
+	/*!< Ring of accepted ranges */
+	uint16_t  Weight[VL53L1_FILTER_DEPTH];
+	/*!< Ring of 1 / sigma^2 weights, 12 bit */
+	uint8_t   Head;            /*!< Next ring slot */
+	uint8_t   Count;           /*!< Number of valid ring entries */
+	uint8_t   RejectCount;     /*!< Consecutive outliers rejected */
+	uint8_t   MaxRejectCount;  /*!< Outliers accepted as a new target after */
+	uint16_t  MinGateMilliMeter;
+	/*!< Outlier gate floor, the gate is max(this, 3 sigma) */
+	int16_t   FilteredMilliMeter;  /*!< Last filter output */
+
+} VL53L1_RangeFilter_t;
+
+/** @brief Filter output
+ */
+typedef struct {
+
+	int16_t   RangeMilliMeter;  /*!< Filtered range in mm */
+	uint8_t   Valid;            /*!< 1 if at least one range was accepted */
+	uint8_t   Rejected;         /*!< 1 if the input range was rejected */
+
+} VL53L1_FilteredRange_t;
+
+
+/**
+ * @brief Initialise a range filter
+ *
+ * @param   pFilter               Pointer to the filter state
+ * @param   MinGateMilliMeter     Smallest deviation from the current
+ * estimate considered an outlier (the gate is widened to 3 sigma)
+ * @param   MaxRejectCount        Number of consecutive outliers after which
+ * the filter restarts on the new distance (target change)
+ * @return  VL53L1_ERROR_NONE            Success
+ */
+VL53L1_Error VL53L1_RangeFilterInit(VL53L1_RangeFilter_t *pFilter,
+	uint16_t MinGateMilliMeter, uint8_t MaxRejectCount);
+
+/**
+ * @brief Push one range through the filter
+ *
+ * @par Function Description
+ * Ranges whose RangeStatus is not VL53L1_RANGESTATUS_RANGE_VALID, or that
+ * fall outside the outlier gate, are rejected and the previous estimate is
+ * returned. Accepted ranges are stored with a 1 / sigma^2 weight computed
+ * from SigmaMilliMeter; the output is the weighted mean of the ring.
+ * Integer only.
+ *
+ * @param   pFilter               Pointer to the filter state
+ * @param   pRangeData            Ranging result to filter
+ * @param   pOut                  Pointer to the filter output
+ * @return  VL53L1_ERROR_NONE            Success
+ */
+VL53L1_Error VL53L1_RangeFilterUpdate(VL53L1_RangeFilter_t *pFilter,
+	const VL53L1_RangingMeasurementData_t *pRangeData,
+	VL53L1_FilteredRange_t *pOut);
+
+/**
+ * @brief Push one range per sensor through the matching filters
+ *
+ * @param   pFilter               Array of NumberOfDevices filter states
+ * @param   pRangeData            Array of NumberOfDevices ranging results
+ * @param   pOut                  Array of NumberOfDevices filter outputs
+ * @param   NumberOfDevices       Number of sensors
+ * @return  VL53L1_ERROR_NONE            Success
+ */
+VL53L1_Error VL53L1_RangeFilterUpdateArray(VL53L1_RangeFilter_t *pFilter,
+	const VL53L1_RangingMeasurementData_t *pRangeData,
+	VL53L1_FilteredRange_t *pOut, uint8_t NumberOfDevices);
+
+/** @} VL53L1_filter_group */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _VL53L1_API_FILTER_H_ */
@@ -0,0 +1,160 @@
+/* SPDX-License-Identifier: GPL-2.0+ OR BSD-3-Clause */
+/******************************************************************************
+ This file is part of VL53L1 and is dual licensed,
+ either GPL-2.0+
+ or 'BSD 3-clause "New" or "Revised" License' , at your option.
+ ******************************************************************************
+ */
+
+/**
+ * @file  vl53l1_api_scheduler.h
+ *
+ * @brief Adaptive ranging scheduler for the low power autonomous preset
+ */
+
+#ifndef _VL53L1_API_SCHEDULER_H_
+#define _VL53L1_API_SCHEDULER_H_
+
+#include "vl53l1_api.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/** @defgroup VL53L1_scheduler_group VL53L1 Adaptive Scheduler Functions
+ *  @brief    Inter measurement period and timing budget chosen at run time
+ *            in VL53L1_PRESETMODE_LOWPOWER_AUTONOMOUS
+ *  @{
+ */
+
+/** @brief Scheduler configuration and state
+ *
+ * The configuration fields are set by the caller before
+ * @a VL53L1_SchedulerInit(), the state fields are owned by the scheduler.
+ */
+typedef struct {
+
+	uint32_t  MinInterMeasurementPeriodMilliSeconds;
+	/*!< Period used while the range is moving, raised to the timing
+	 * budget + 4 ms when the budget does not fit */
+	uint32_t  MaxInterMeasurementPeriodMilliSeconds;
+	/*!< Longest period, bounds the motion detection latency */
+	uint32_t  MinTimingBudgetMicroSeconds;
+	/*!< Lower timing budget limit */
+	uint32_t  MaxTimingBudgetMicroSeconds;
+	/*!< Upper timing budget limit */
+	FixPoint1616_t TargetSigmaMilliMeter;
+	/*!< Sigma the timing budget is tuned for */
+	uint16_t  StableRangeMilliMeter;
+	/*!< Range change below which the scene is stable, also the half width
+	 * of the motion detection window */
+	uint8_t   StableCount;
+	/*!< Stable ranges before the period is doubled */
+
+	uint32_t  InterMeasurementPeriodMilliSeconds;
+	/*!< Period in use */
+	uint32_t  TimingBudgetMicroSeconds;
+	/*!< Timing budget in use */
+	FixPoint1616_t SigmaMilliMeter;
+	/*!< Running average of the sigma of valid ranges */
+	int16_t   LastRangeMilliMeter;
+	/*!< Last valid range */
+	uint8_t   LastRangeStatus;
+	/*!< Status of the previous range, VL53L1_RANGESTATUS_NONE after a
+	 * start */
+	uint8_t   StableRuns;
+	/*!< Consecutive stable ranges */
+	uint8_t   SigmaSamples;
+	/*!< Valid ranges averaged since the last timing budget change */
+	uint8_t   MotionWindowArmed;
+	/*!< 1 while the device only interrupts on out of window ranges */
+	uint32_t  ReconfigureCount;
+	/*!< Number of stop / reconfigure / start cycles */
+
+} VL53L1_Scheduler_t;
+
+
+/**
+ * @brief Initialise the scheduler and configure the device
+ *
+ * @par Function Description
+ * Selects VL53L1_PRESETMODE_LOWPOWER_AUTONOMOUS and starts with the
+ * shortest period and the largest timing budget. Ranging is not started.
+ *
+ * @note This function Access to the device
+ *
+ * @param   Dev                   Device Handle
+ * @param   pSched                Pointer to the scheduler, configuration
+ * fields filled in
+ * @return  VL53L1_ERROR_NONE            Success
+ * @return  VL53L1_ERROR_INVALID_PARAMS  Inconsistent limits, or the
+ * longest period can not hold the largest timing budget, or the shortest
+ * period the smallest one
+ * @return  "Other error code"           See ::VL53L1_Error
+ */
+VL53L1_Error VL53L1_SchedulerInit(VL53L1_DEV Dev,
+	VL53L1_Scheduler_t *pSched);
+
+/**
+ * @brief Start ranging under scheduler control
+ *
+ * @note This function Access to the device
+ *
+ * @param   Dev                   Device Handle
+ * @param   pSched                Pointer to the scheduler
+ * @return  VL53L1_ERROR_NONE            Success
+ * @return  "Other error code"           See ::VL53L1_Error
+ */
+VL53L1_Error VL53L1_SchedulerStart(VL53L1_DEV Dev,
+	VL53L1_Scheduler_t *pSched);
+
+/**
+ * @brief Feed a range to the scheduler and start the next one
+ *
+ * @par Function Description
+ * Replaces @a VL53L1_ClearInterruptAndStartMeasurement() in the ranging
+ * loop.
+ * - A valid range further than StableRangeMilliMeter from the last one, or
+ * a target appearing or disappearing, is motion: the period drops to the
+ * minimum. After StableCount stable ranges the period is doubled, up to the
+ * maximum, where a distance window of +/- StableRangeMilliMeter is armed
+ * with @a VL53L1_SetThresholdConfig() so the device keeps ranging without
+ * interrupting the host until the target moves.
+ * - The timing budget is scaled by (sigma / target sigma)^2 once the
+ * averaged sigma is more than 1/8 away from the target.
+ * Any change is applied with a stop / reconfigure / start cycle.
+ *
+ * @note This function Access to the device
+ *
+ * @param   Dev                   Device Handle
+ * @param   pSched                Pointer to the scheduler
+ * @param   pRangeData            Range just read with
+ * @a VL53L1_GetRangingMeasurementData()
+ * @return  VL53L1_ERROR_NONE            Success
+ * @return  "Other error code"           See ::VL53L1_Error
+ */
+VL53L1_Error VL53L1_SchedulerUpdate(VL53L1_DEV Dev,
+	VL53L1_Scheduler_t *pSched,
+	VL53L1_RangingMeasurementData_t *pRangeData);
+
+/**
+ * @brief Stop ranging and disarm the motion detection window
+ *
+ * @note This function Access to the device
+ *
+ * @param   Dev                   Device Handle
+ * @param   pSched                Pointer to the scheduler
+ * @return  VL53L1_ERROR_NONE            Success
+ * @return  "Other error code"           See ::VL53L1_Error
+ */
+VL53L1_Error VL53L1_SchedulerStop(VL53L1_DEV Dev,
+	VL53L1_Scheduler_t *pSched);
+
+/** @} VL53L1_scheduler_group */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _VL53L1_API_SCHEDULER_H_ */
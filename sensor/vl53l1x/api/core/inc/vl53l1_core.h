@@ -126,6 +126,20 @@ VL53L1_Error VL53L1_check_ll_driver_rd_state(
 	VL53L1_DEV         Dev);
 
 
+/**
+ * @brief Forget the configuration register image held for the device
+ *
+ * To be called after any configuration register write that does not go
+ * through VL53L1_init_and_start_range() with the LL driver data values,
+ * so that the next range start sends the full configuration again.
+ *
+ * @param[out]   Dev       : Device handle
+ */
+
+void VL53L1_invalidate_cfg_image(
+	VL53L1_DEV         Dev);
+
+
 /**
  * @brief Update LL Driver Configuration State
  *
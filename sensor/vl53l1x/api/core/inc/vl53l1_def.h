@@ -21,6 +21,7 @@
 #define _VL53L1_DEF_H_
 
 #include "vl53l1_ll_def.h"
+#include "vl53l1_preset_setup.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -253,6 +254,8 @@ typedef struct {
 	/*!< This Array stores all the Limit Check current value from latest
 	 * ranging
 	 */
+	VL53L1_DeviceResultsLevel RangingResultsLevel;
+	/*!< Results read back by VL53L1_GetRangingMeasurementData() */
 } VL53L1_DeviceParameters_t;
 
 
@@ -360,6 +363,59 @@ typedef struct {
  *
  */
 
+#ifndef VL53L1_MAX_SCAN_ZONES
+#define VL53L1_MAX_SCAN_ZONES 16
+/*!< Maximum number of zones handled by the zone scan sequencer */
+#endif
+
+typedef struct {
+
+	uint8_t             NumberOfRoi;   /*!< Number of Rois defined*/
+
+	VL53L1_UserRoi_t    UserRois[VL53L1_MAX_SCAN_ZONES];
+	/*!< List of Rois */
+
+} VL53L1_RoiConfig_t;
+
+
+/** @brief Zone scan sequencer state
+ *
+ *  Register images (ROI centre SPAD, global XY size) precomputed for each
+ *  zone, loaded into the dynamic configuration before each handshake.
+ */
+
+typedef struct {
+
+	uint32_t  FrameCount;     /*!< Number of frames completed */
+	uint8_t   NumberOfZones;  /*!< 0 = zone scan disabled */
+	uint8_t   CurrentZone;    /*!< Zone of the range in progress */
+	uint8_t   RoiCentreSpad[VL53L1_MAX_SCAN_ZONES];
+	/*!< roi_config__user_roi_centre_spad image */
+	uint8_t   RoiXYSize[VL53L1_MAX_SCAN_ZONES];
+	/*!< roi_config__user_roi_requested_global_xy_size image */
+	uint8_t   UserRoiCentreSpad;
+	/*!< User ROI centre SPAD, restored when the sequencer is disabled */
+	uint8_t   UserRoiXYSize;
+	/*!< User ROI global XY size, restored when the sequencer is disabled */
+
+} VL53L1_ZoneScanData_t;
+
+
+/** @brief One depth frame produced by the zone scan sequencer
+ */
+
+typedef struct {
+
+	uint32_t  FrameCount;     /*!< Frame sequence number */
+	uint8_t   NumberOfZones;  /*!< Number of valid entries below */
+	int16_t   RangeMilliMeter[VL53L1_MAX_SCAN_ZONES];
+	/*!< Range per zone in mm, order of VL53L1_RoiConfig_t */
+	uint8_t   RangeStatus[VL53L1_MAX_SCAN_ZONES];
+	/*!< Range status per zone, see VL53L1_define_RangeStatus_group */
+
+} VL53L1_ZoneScanFrame_t;
+
+
 /**
  * @struct VL53L1_CustomerNvmManaged_t
  *
@@ -410,6 +466,20 @@ typedef struct {
 		VL53L1_ADDITIONAL_CALIBRATION_DATA_STRUCT_VERSION)
 /* VL53L1 Calibration Data struct version */
 
+#define VL53L1_CALIBRATION_BLOB_MAGIC  0x564C3143
+/*!< "VL1C", first word of a serialized calibration blob */
+
+#define VL53L1_CALIBRATION_BLOB_HEADER_SIZE  16
+/*!< Blob header: magic, struct version, payload size, flags, CRC-32 */
+
+#define VL53L1_CALIBRATION_BLOB_SIZE \
+		(VL53L1_CALIBRATION_BLOB_HEADER_SIZE + \
+		sizeof(VL53L1_CalibrationData_t))
+/*!< Size in bytes of the buffer used by VL53L1_GetCalibrationBlob() */
+
+#define VL53L1_CALIBRATION_BLOB_FLAG_XTALK_COMP  0x01
+/*!< Blob flag: crosstalk compensation enabled */
+
 /**
  * @struct  VL53L1_AdditionalData_t
  * @brief   Structure for storing the Additional Data
@@ -496,6 +566,12 @@ typedef struct {
 	VL53L1_DeviceParameters_t CurrentParameters;
 	/*!< Current Device Parameter */
 
+	VL53L1_ZoneScanData_t ZoneScan;
+	/*!< Zone scan sequencer state */
+
+	int32_t BDTable[VL53L1_TUNING_MAX_TUNABLE_KEY];
+	/*!< Bare driver tuning parameters, see ::VL53L1_Tuning_t */
+
 } VL53L1_DevData_t;
 
 
@@ -240,6 +240,9 @@ typedef int8_t VL53L1_Error;
 #define VL53L1_ERROR_NOT_IMPLEMENTED                   ((VL53L1_Error) - 41)
 	/*!< Tells requested functionality has not been implemented yet or
 	 * not compatible with the device */
+#define VL53L1_ERROR_CALIBRATION_BLOB_INVALID          ((VL53L1_Error) - 42)
+	/*!< Tells the calibration blob has a wrong magic, version, size or
+	 * CRC and must be rebuilt by calibrating the device */
 #define VL53L1_ERROR_PLATFORM_SPECIFIC_START           ((VL53L1_Error) - 60)
 	/*!< Tells the starting code for platform */
 /** @} VL53L1_define_Error_group */
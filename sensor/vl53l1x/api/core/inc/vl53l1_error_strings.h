@@ -195,6 +195,8 @@ VL53L1_Error VL53L1_get_pal_error_string(
 
 	#define  VL53L1_STRING_ERROR_NOT_IMPLEMENTED \
 			"Not implemented error"
+	#define  VL53L1_STRING_ERROR_CALIBRATION_BLOB_INVALID \
+			"Calibration blob invalid"
 	#define  VL53L1_STRING_UNKNOW_ERROR_CODE \
 			"Unknown Error Code"
 
@@ -803,6 +803,51 @@ typedef struct {
 } VL53L1_offsetcal_config_t;
 
 
+/** @brief Range completion interrupt hook
+ *
+ * Function installed by the platform to block until the GPIO1 interrupt
+ * of the device fires (typically a semaphore given from the GPIO ISR).
+ * It must return VL53L1_ERROR_NONE when an interrupt event was received,
+ * VL53L1_ERROR_TIME_OUT when timeout_ms elapsed without event and
+ * VL53L1_ERROR_NOT_IMPLEMENTED to request the polling fallback.
+ */
+
+typedef VL53L1_Error (*VL53L1_WaitInterruptFunc)(
+	void     *pctx,
+	uint32_t  timeout_ms);
+
+typedef struct {
+
+	VL53L1_WaitInterruptFunc  wait_func;
+		/*!< Blocking wait for the GPIO1 event, NULL = polling */
+	void                     *pctx;
+		/*!< Platform context passed back to wait_func */
+
+} VL53L1_interrupt_hook_t;
+
+
+/**
+ * @struct VL53L1_cfg_image_t
+ *
+ * Copy of the static NVM managed to timing config register groups as last
+ * written by VL53L1_init_and_start_range(). Groups that still match the
+ * device are left out of the start burst when ranging is restarted.
+ */
+
+#define VL53L1_CFG_IMAGE_I2C_SIZE_BYTES \
+	(VL53L1_DYNAMIC_CONFIG_I2C_INDEX - VL53L1_STATIC_NVM_MANAGED_I2C_INDEX)
+
+typedef struct {
+
+	uint16_t  valid_from_index;
+		/*!< First register index known to match the device,
+		 *   VL53L1_DYNAMIC_CONFIG_I2C_INDEX when nothing is known */
+	uint8_t   buffer[VL53L1_CFG_IMAGE_I2C_SIZE_BYTES];
+		/*!< Register image from VL53L1_STATIC_NVM_MANAGED_I2C_INDEX */
+
+} VL53L1_cfg_image_t;
+
+
 
 /**
  * @struct VL53L1_LLDriverData_t
@@ -841,6 +886,12 @@ typedef struct {
 	uint8_t   debug_mode;
 		/*!< Internal Only - read extra debug data */
 
+	/*!< range completion interrupt hook */
+	VL53L1_interrupt_hook_t             irq_hook;
+
+	/*!< configuration register image on the device */
+	VL53L1_cfg_image_t                  cfg_image;
+
 	/*!< version info structure */
 	VL53L1_ll_version_t                 version;
 
@@ -368,14 +368,17 @@ typedef uint8_t VL53L1_DeviceConfigLevel;
  */
 typedef uint8_t VL53L1_DeviceResultsLevel;
 
-#define VL53L1_DEVICERESULTSLEVEL_SYSTEM_RESULTS  \
+#define VL53L1_DEVICERESULTSLEVEL_SIMPLE  \
 	((VL53L1_DeviceResultsLevel)  0)
+	/*!< Read the stream 0 (sd0) part of system_results only */
+#define VL53L1_DEVICERESULTSLEVEL_SYSTEM_RESULTS  \
+	((VL53L1_DeviceResultsLevel)  1)
 	/*!< Read just system_results  */
 #define VL53L1_DEVICERESULTSLEVEL_UPTO_CORE  \
-	((VL53L1_DeviceResultsLevel)  1)
+	((VL53L1_DeviceResultsLevel)  2)
 	/*!< Read both system and core results */
 #define VL53L1_DEVICERESULTSLEVEL_FULL  \
-	((VL53L1_DeviceResultsLevel)  2)
+	((VL53L1_DeviceResultsLevel)  3)
 	/*!< Read system, core and debug results */
 
 /** @} end of VL53L1_DeviceResultsLevel_group */
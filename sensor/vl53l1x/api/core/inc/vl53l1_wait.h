@@ -112,7 +112,7 @@ VL53L1_Error VL53L1_wait_for_firmware_ready(
 /**
  * @brief  Waits for the next ranging interrupt
  *
- * Calls VL53L1_poll_for_range_completion()
+ * Calls VL53L1_wait_for_range_event()
  *
  * @param[in]   Dev             :  Device handle
  *
@@ -127,7 +127,7 @@ VL53L1_Error VL53L1_wait_for_range_completion(
 /**
  * @brief  Waits for a device test mode to complete.
 
- * Calls VL53L1_poll_for_test_completion()
+ * Calls VL53L1_wait_for_range_event()
  *
  * @param[in]   Dev             : Device Handle
  *
@@ -268,6 +268,45 @@ VL53L1_Error VL53L1_poll_for_range_completion(
 	uint32_t     timeout_ms);
 
 
+/**
+ * @brief  Waits for the ranging interrupt using the platform interrupt hook
+ *
+ * Blocks in pdev->irq_hook.wait_func() until the GPIO1 event is signalled,
+ * then confirms it with a single read of VL53L1_GPIO__TIO_HV_STATUS.
+ * Stale events are discarded and the wait resumes for the remaining time.
+ *
+ * @param[in]   Dev           : Device handle
+ * @param[in]   timeout_ms    : Wait timeout in [ms]
+ *
+ * @return  VL53L1_ERROR_NONE              Success
+ * @return  VL53L1_ERROR_TIME_OUT          No range completed in time
+ * @return  VL53L1_ERROR_NOT_IMPLEMENTED   No hook installed
+ * @return  "Other error code"    See ::VL53L1_Error
+ */
+
+VL53L1_Error VL53L1_wait_for_range_interrupt(
+	VL53L1_DEV   Dev,
+	uint32_t     timeout_ms);
+
+
+/**
+ * @brief  Waits for range completion, interrupt driven when possible
+ *
+ * Calls VL53L1_wait_for_range_interrupt() and falls back to
+ * VL53L1_poll_for_range_completion() if no interrupt hook is available.
+ *
+ * @param[in]   Dev           : Device handle
+ * @param[in]   timeout_ms    : Wait timeout in [ms]
+ *
+ * @return  VL53L1_ERROR_NONE     Success
+ * @return  "Other error code"    See ::VL53L1_Error
+ */
+
+VL53L1_Error VL53L1_wait_for_range_event(
+	VL53L1_DEV   Dev,
+	uint32_t     timeout_ms);
+
+
 
 #ifdef __cplusplus
 }
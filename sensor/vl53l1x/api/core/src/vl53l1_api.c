@@ -65,8 +65,10 @@
 
 /* local static utilities functions */
 
-/* Bare Driver Tuning parameter table indexed with VL53L1_Tuning_t */
-static int32_t BDTable[VL53L1_TUNING_MAX_TUNABLE_KEY] = {
+/* Bare Driver Tuning parameter defaults indexed with VL53L1_Tuning_t,
+ * copied into the per-device table by VL53L1_DataInit()
+ */
+static const int32_t BDTableDefault[VL53L1_TUNING_MAX_TUNABLE_KEY] = {
 		TUNING_VERSION,
 		TUNING_PROXY_MIN,
 		TUNING_SINGLE_TARGET_XTALK_TARGET_DISTANCE_MM,
@@ -81,6 +83,9 @@ static int32_t BDTable[VL53L1_TUNING_MAX_TUNABLE_KEY] = {
 		TUNING_PHASECAL_PATCH_POWER
 };
 
+/* Per-device tuning parameter table */
+#define BDTABLE(Dev) (VL53L1DevDataGet(Dev, BDTable))
+
 
  static VL53L1_Error VL53L1_LoadPatch(VL53L1_DEV Dev);
  static VL53L1_Error VL53L1_UnloadPatch(VL53L1_DEV Dev);
@@ -328,7 +333,7 @@ static VL53L1_Error SingleTargetXTalkCalibration(VL53L1_DEV Dev)
 	FixPoint1616_t total_count = 0;
 	uint8_t xtalk_meas = 0;
 	uint8_t xtalk_measmax =
-		BDTable[VL53L1_TUNING_SINGLE_TARGET_XTALK_SAMPLE_NUMBER];
+		BDTABLE(Dev)[VL53L1_TUNING_SINGLE_TARGET_XTALK_SAMPLE_NUMBER];
 	VL53L1_RangingMeasurementData_t RMData;
 	FixPoint1616_t xTalkStoredMeanSignalRate;
 	FixPoint1616_t xTalkStoredMeanRange;
@@ -417,7 +422,7 @@ static VL53L1_Error SingleTargetXTalkCalibration(VL53L1_DEV Dev)
 		 * Note that the cal distance is in mm, therefore no resolution
 		 * is lost.
 		 */
-		 xTalkCalDistanceAsInt = ((uint32_t)BDTable[
+		 xTalkCalDistanceAsInt = ((uint32_t)BDTABLE(Dev)[
 			VL53L1_TUNING_SINGLE_TARGET_XTALK_TARGET_DISTANCE_MM]);
 		if (xTalkStoredMeanRtnSpadsAsInt == 0 ||
 		xTalkCalDistanceAsInt == 0 ||
@@ -744,10 +749,19 @@ VL53L1_Error VL53L1_DataInit(VL53L1_DEV Dev)
 	if (Status == VL53L1_ERROR_NONE)
 		Status = VL53L1_data_init(Dev, 1);
 
+	memcpy(BDTABLE(Dev), BDTableDefault, sizeof(BDTableDefault));
+
 
 	if (Status == VL53L1_ERROR_NONE)
 		VL53L1DevDataSet(Dev, PalState, VL53L1_STATE_WAIT_STATICINIT);
 
+	VL53L1_SETPARAMETERFIELD(Dev, RangingResultsLevel,
+			VL53L1_DEVICERESULTSLEVEL_FULL);
+
+	VL53L1DevDataSet(Dev, ZoneScan.NumberOfZones, 0);
+	VL53L1DevDataSet(Dev, ZoneScan.CurrentZone, 0);
+	VL53L1DevDataSet(Dev, ZoneScan.FrameCount, 0);
+
 	/* Enable all check */
 	for (i = 0; i < VL53L1_CHECKENABLE_NUMBER_OF_CHECKS; i++) {
 		if (Status == VL53L1_ERROR_NONE)
@@ -1596,6 +1610,161 @@ VL53L1_Error VL53L1_GetUserROI(VL53L1_DEV Dev,
 
 
 
+/* In back to back mode the grouped parameter hold applies a new ROI one
+ * range late, so a range can only be matched with its zone in timed or
+ * single shot mode.
+ */
+static VL53L1_Error CheckZoneScanMode(VL53L1_DEV Dev)
+{
+	uint8_t DeviceMeasurementMode;
+
+	DeviceMeasurementMode = VL53L1DevDataGet(Dev, LLData.measurement_mode);
+	if ((DeviceMeasurementMode != VL53L1_DEVICEMEASUREMENTMODE_TIMED) &&
+		(DeviceMeasurementMode !=
+		VL53L1_DEVICEMEASUREMENTMODE_SINGLESHOT))
+		return VL53L1_ERROR_INVALID_COMMAND;
+
+	return VL53L1_ERROR_NONE;
+}
+
+VL53L1_Error VL53L1_SetZoneScanConfig(VL53L1_DEV Dev,
+		VL53L1_RoiConfig_t *pRoiConfig)
+{
+	VL53L1_Error Status = VL53L1_ERROR_NONE;
+	VL53L1_LLDriverData_t *pdev = VL53L1DevStructGetLLDriverHandle(Dev);
+	VL53L1_ZoneScanData_t *pscan = &(VL53L1DevDataGet(Dev, ZoneScan));
+	VL53L1_UserRoi_t *pRoi;
+	VL53L1_user_zone_t user_zone;
+	uint8_t i;
+
+	LOG_FUNCTION_START("");
+
+	if (pRoiConfig->NumberOfRoi > VL53L1_MAX_SCAN_ZONES)
+		Status = VL53L1_ERROR_INVALID_PARAMS;
+	else if (pRoiConfig->NumberOfRoi > 0)
+		Status = CheckZoneScanMode(Dev);
+
+	/* encode every zone once, same checks as VL53L1_SetUserROI() */
+	for (i = 0; (i < pRoiConfig->NumberOfRoi) &&
+		(Status == VL53L1_ERROR_NONE); i++) {
+		pRoi = &(pRoiConfig->UserRois[i]);
+		Status = CheckValidRectRoi(*pRoi);
+		if (Status != VL53L1_ERROR_NONE)
+			break;
+
+		user_zone.x_centre = (pRoi->BotRightX + pRoi->TopLeftX  + 1) / 2;
+		user_zone.y_centre = (pRoi->TopLeftY  + pRoi->BotRightY + 1) / 2;
+		user_zone.width =    (pRoi->BotRightX - pRoi->TopLeftX);
+		user_zone.height =   (pRoi->TopLeftY  - pRoi->BotRightY);
+		if ((user_zone.width < 3) || (user_zone.height < 3)) {
+			Status = VL53L1_ERROR_INVALID_PARAMS;
+			break;
+		}
+
+		VL53L1_encode_row_col(user_zone.y_centre, user_zone.x_centre,
+				&(pscan->RoiCentreSpad[i]));
+		VL53L1_encode_zone_size(user_zone.width, user_zone.height,
+				&(pscan->RoiXYSize[i]));
+	}
+
+	/* the user ROI is saved when the sequencer is enabled and put back
+	 * when it is disabled, so that the last zone does not stay programmed
+	 */
+	if ((Status == VL53L1_ERROR_NONE) && (pscan->NumberOfZones == 0) &&
+		(pRoiConfig->NumberOfRoi > 0)) {
+		pscan->UserRoiCentreSpad =
+			pdev->dyn_cfg.roi_config__user_roi_centre_spad;
+		pscan->UserRoiXYSize =
+			pdev->dyn_cfg.roi_config__user_roi_requested_global_xy_size;
+	} else if ((pscan->NumberOfZones > 0) &&
+		((Status != VL53L1_ERROR_NONE) ||
+		(pRoiConfig->NumberOfRoi == 0))) {
+		pdev->dyn_cfg.roi_config__user_roi_centre_spad =
+			pscan->UserRoiCentreSpad;
+		pdev->dyn_cfg.roi_config__user_roi_requested_global_xy_size =
+			pscan->UserRoiXYSize;
+	}
+
+	if (Status == VL53L1_ERROR_NONE) {
+		pscan->NumberOfZones = pRoiConfig->NumberOfRoi;
+		pscan->CurrentZone = 0;
+		pscan->FrameCount = 0;
+
+		/* first range of the next StartMeasurement uses zone 0 */
+		if (pscan->NumberOfZones > 0) {
+			pdev->dyn_cfg.roi_config__user_roi_centre_spad =
+				pscan->RoiCentreSpad[0];
+			pdev->dyn_cfg.roi_config__user_roi_requested_global_xy_size =
+				pscan->RoiXYSize[0];
+		}
+	} else {
+		pscan->NumberOfZones = 0;
+		if (Status != VL53L1_ERROR_INVALID_COMMAND)
+			Status = VL53L1_ERROR_INVALID_PARAMS;
+	}
+
+	LOG_FUNCTION_END(Status);
+	return Status;
+}
+
+VL53L1_Error VL53L1_GetZoneScanFrame(VL53L1_DEV Dev,
+		VL53L1_ZoneScanFrame_t *pFrame)
+{
+	VL53L1_Error Status = VL53L1_ERROR_NONE;
+	VL53L1_LLDriverData_t *pdev = VL53L1DevStructGetLLDriverHandle(Dev);
+	VL53L1_ZoneScanData_t *pscan = &(VL53L1DevDataGet(Dev, ZoneScan));
+	VL53L1_RangingMeasurementData_t RMData;
+	uint8_t zone;
+	uint8_t i;
+
+	LOG_FUNCTION_START("");
+
+	if (pscan->NumberOfZones == 0)
+		Status = VL53L1_ERROR_INVALID_COMMAND;
+	else if (VL53L1DevDataGet(Dev, PalState) != VL53L1_STATE_RUNNING)
+		Status = VL53L1_ERROR_INVALID_COMMAND;
+	else
+		Status = CheckZoneScanMode(Dev);
+
+	for (i = 0; (i < pscan->NumberOfZones) &&
+		(Status == VL53L1_ERROR_NONE); i++) {
+		zone = pscan->CurrentZone;
+
+		Status = VL53L1_WaitMeasurementDataReady(Dev);
+		if (Status == VL53L1_ERROR_NONE)
+			Status = VL53L1_GetRangingMeasurementData(Dev, &RMData);
+		if (Status != VL53L1_ERROR_NONE)
+			break;
+
+		pFrame->RangeMilliMeter[zone] = RMData.RangeMilliMeter;
+		pFrame->RangeStatus[zone] = RMData.RangeStatus;
+
+		/* the next zone image rides on the handshake burst that
+		 * clears the interrupt: no extra bus transaction and no
+		 * stop / start of the ranging sequence
+		 */
+		zone++;
+		if (zone == pscan->NumberOfZones)
+			zone = 0;
+		pdev->dyn_cfg.roi_config__user_roi_centre_spad =
+			pscan->RoiCentreSpad[zone];
+		pdev->dyn_cfg.roi_config__user_roi_requested_global_xy_size =
+			pscan->RoiXYSize[zone];
+
+		Status = VL53L1_ClearInterruptAndStartMeasurement(Dev);
+		if (Status == VL53L1_ERROR_NONE)
+			pscan->CurrentZone = zone;
+	}
+
+	if (Status == VL53L1_ERROR_NONE) {
+		pFrame->NumberOfZones = pscan->NumberOfZones;
+		pFrame->FrameCount = pscan->FrameCount++;
+	}
+
+	LOG_FUNCTION_END(Status);
+	return Status;
+}
+
 /* End Group ROI Functions */
 
 
@@ -1813,13 +1982,28 @@ VL53L1_Error VL53L1_WaitMeasurementDataReady(VL53L1_DEV Dev)
 	* VL53L1_RANGE_COMPLETION_POLLING_TIMEOUT_MS defined in def.h
 	*/
 
-	Status = VL53L1_poll_for_range_completion(Dev,
+	Status = VL53L1_wait_for_range_event(Dev,
 			VL53L1_RANGE_COMPLETION_POLLING_TIMEOUT_MS);
 
 	LOG_FUNCTION_END(Status);
 	return Status;
 }
 
+VL53L1_Error VL53L1_SetInterruptHook(VL53L1_DEV Dev,
+	VL53L1_WaitInterruptFunc WaitFunc, void *pCtx)
+{
+	VL53L1_Error Status = VL53L1_ERROR_NONE;
+	VL53L1_LLDriverData_t *pdev = VL53L1DevStructGetLLDriverHandle(Dev);
+
+	LOG_FUNCTION_START("");
+
+	pdev->irq_hook.wait_func = WaitFunc;
+	pdev->irq_hook.pctx = pCtx;
+
+	LOG_FUNCTION_END(Status);
+	return Status;
+}
+
 
 
 static uint8_t ComputeRQL(uint8_t active_results,
@@ -2027,7 +2211,7 @@ static VL53L1_Error SetSimpleData(VL53L1_DEV Dev,
 	Range = pRangeData->RangeMilliMeter;
 	if ((pRangeData->RangeStatus == VL53L1_RANGESTATUS_RANGE_VALID) &&
 		(Range < 0)) {
-		if (Range < BDTable[VL53L1_TUNING_PROXY_MIN])
+		if (Range < BDTABLE(Dev)[VL53L1_TUNING_PROXY_MIN])
 			pRangeData->RangeStatus =
 					VL53L1_RANGESTATUS_RANGE_INVALID;
 		else
@@ -2046,18 +2230,23 @@ VL53L1_Error VL53L1_GetRangingMeasurementData(VL53L1_DEV Dev,
 	VL53L1_range_results_t results;
 	VL53L1_range_results_t *presults = &results;
 	VL53L1_range_data_t *presults_data;
+	VL53L1_DeviceResultsLevel ResultsLevel;
 
 	LOG_FUNCTION_START("");
 
+	VL53L1_GETPARAMETERFIELD(Dev, RangingResultsLevel, ResultsLevel);
 
-	/* Clear Ranging Data */
-	memset(pRangingMeasurementData, 0xFF,
-		sizeof(VL53L1_RangingMeasurementData_t));
+	/* Clear Ranging Data, every field is written by SetSimpleData()
+	 * so the fast path skips it
+	 */
+	if (ResultsLevel == VL53L1_DEVICERESULTSLEVEL_FULL)
+		memset(pRangingMeasurementData, 0xFF,
+			sizeof(VL53L1_RangingMeasurementData_t));
 
 	/* Get Ranging Data */
 	Status = VL53L1_get_device_results(
 			Dev,
-			VL53L1_DEVICERESULTSLEVEL_FULL,
+			ResultsLevel,
 			presults);
 
 	if (Status == VL53L1_ERROR_NONE) {
@@ -2081,6 +2270,37 @@ VL53L1_Error VL53L1_GetRangingMeasurementData(VL53L1_DEV Dev,
 
 
 
+VL53L1_Error VL53L1_SetRangingResultsLevel(VL53L1_DEV Dev,
+	VL53L1_DeviceResultsLevel ResultsLevel)
+{
+	VL53L1_Error Status = VL53L1_ERROR_NONE;
+
+	LOG_FUNCTION_START("");
+
+	if ((ResultsLevel != VL53L1_DEVICERESULTSLEVEL_SIMPLE) &&
+		(ResultsLevel != VL53L1_DEVICERESULTSLEVEL_FULL))
+		Status = VL53L1_ERROR_INVALID_PARAMS;
+	else
+		VL53L1_SETPARAMETERFIELD(Dev, RangingResultsLevel,
+				ResultsLevel);
+
+	LOG_FUNCTION_END(Status);
+	return Status;
+}
+
+VL53L1_Error VL53L1_GetRangingResultsLevel(VL53L1_DEV Dev,
+	VL53L1_DeviceResultsLevel *pResultsLevel)
+{
+	VL53L1_Error Status = VL53L1_ERROR_NONE;
+
+	LOG_FUNCTION_START("");
+
+	VL53L1_GETPARAMETERFIELD(Dev, RangingResultsLevel, *pResultsLevel);
+
+	LOG_FUNCTION_END(Status);
+	return Status;
+}
+
 /* End Group PAL Measurement Functions */
 
 
@@ -2097,7 +2317,7 @@ VL53L1_Error VL53L1_SetTuningParameter(VL53L1_DEV Dev,
 			TuningParameterValue);
 	else {
 		if (TuningParameterId < VL53L1_TUNING_MAX_TUNABLE_KEY)
-			BDTable[TuningParameterId] = TuningParameterValue;
+			BDTABLE(Dev)[TuningParameterId] = TuningParameterValue;
 		else
 			Status = VL53L1_ERROR_INVALID_PARAMS;
 	}
@@ -2119,7 +2339,7 @@ VL53L1_Error VL53L1_GetTuningParameter(VL53L1_DEV Dev,
 			pTuningParameterValue);
 	else {
 		if (TuningParameterId < VL53L1_TUNING_MAX_TUNABLE_KEY)
-			*pTuningParameterValue = BDTable[TuningParameterId];
+			*pTuningParameterValue = BDTABLE(Dev)[TuningParameterId];
 		else
 			Status = VL53L1_ERROR_INVALID_PARAMS;
 	}
@@ -2249,7 +2469,7 @@ VL53L1_Error VL53L1_PerformSingleTargetXTalkCalibration(VL53L1_DEV Dev,
 	LOG_FUNCTION_START("");
 
 	if (CalDistanceMilliMeter > 0) {
-		BDTable[VL53L1_TUNING_SINGLE_TARGET_XTALK_TARGET_DISTANCE_MM] =
+		BDTABLE(Dev)[VL53L1_TUNING_SINGLE_TARGET_XTALK_TARGET_DISTANCE_MM] =
 				CalDistanceMilliMeter;
 		Status = SingleTargetXTalkCalibration(Dev);
 	} else
@@ -2285,8 +2505,8 @@ VL53L1_Error VL53L1_PerformOffsetSimpleCalibration(VL53L1_DEV Dev,
 	pdev->customer.algo__part_to_part_range_offset_mm = 0;
 	pdev->customer.mm_config__inner_offset_mm = 0;
 	pdev->customer.mm_config__outer_offset_mm = 0;
-	Repeat = BDTable[VL53L1_TUNING_SIMPLE_OFFSET_CALIBRATION_REPEAT];
-	Max = BDTable[
+	Repeat = BDTABLE(Dev)[VL53L1_TUNING_SIMPLE_OFFSET_CALIBRATION_REPEAT];
+	Max = BDTABLE(Dev)[
 		VL53L1_TUNING_MAX_SIMPLE_OFFSET_CALIBRATION_SAMPLE_NUMBER];
 	UnderMax = 1 + (Max / 2);
 	OverMax = Max + (Max / 2);
@@ -2375,10 +2595,10 @@ VL53L1_Error VL53L1_PerformOffsetZeroDistanceCalibration(VL53L1_DEV Dev)
 	pdev->customer.algo__part_to_part_range_offset_mm = 0;
 	pdev->customer.mm_config__inner_offset_mm = START_OFFSET;
 	pdev->customer.mm_config__outer_offset_mm = START_OFFSET;
-	ZeroDistanceOffset = BDTable[
+	ZeroDistanceOffset = BDTABLE(Dev)[
 		VL53L1_TUNING_ZERO_DISTANCE_OFFSET_NON_LINEAR_FACTOR];
-	Repeat = BDTable[VL53L1_TUNING_SIMPLE_OFFSET_CALIBRATION_REPEAT];
-	Max = BDTable[
+	Repeat = BDTABLE(Dev)[VL53L1_TUNING_SIMPLE_OFFSET_CALIBRATION_REPEAT];
+	Max = BDTABLE(Dev)[
 		VL53L1_TUNING_MAX_SIMPLE_OFFSET_CALIBRATION_SAMPLE_NUMBER];
 	UnderMax = 1 + (Max / 2);
 	OverMax = Max + (Max / 2);
@@ -2539,6 +2759,8 @@ VL53L1_Error VL53L1_GetCalibrationData(VL53L1_DEV Dev,
 
 	LOG_FUNCTION_START("");
 
+	memset(&cal_data, 0, sizeof(VL53L1_calibration_data_t));
+
 	/* struct_version is filled inside get part to part function */
 	Status = VL53L1_get_part_to_part_data(Dev, &cal_data);
 
@@ -2613,6 +2835,155 @@ VL53L1_Error VL53L1_GetCalibrationData(VL53L1_DEV Dev,
 
 
 
+/* calibration blob header layout, MS byte first */
+#define CALBLOB_MAGIC_OFFSET    0
+#define CALBLOB_VERSION_OFFSET  4
+#define CALBLOB_SIZE_OFFSET     8
+#define CALBLOB_FLAGS_OFFSET    10
+#define CALBLOB_CRC_OFFSET      12
+
+static uint32_t CalibrationBlobCrc(uint8_t *pBlob, uint32_t BlobSize)
+{
+	/* CRC-32 (IEEE 802.3, reflected) of the header up to the CRC field
+	 * followed by the payload
+	 */
+	uint32_t crc = 0xFFFFFFFF;
+	uint32_t i;
+	uint8_t b;
+
+	for (i = 0; i < BlobSize; i++) {
+		if (i == CALBLOB_CRC_OFFSET)
+			i = VL53L1_CALIBRATION_BLOB_HEADER_SIZE;
+		crc ^= pBlob[i];
+		for (b = 0; b < 8; b++)
+			crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+	}
+
+	return ~crc;
+}
+
+static VL53L1_Error CheckCalibrationBlob(uint8_t *pBlob, uint32_t BlobSize)
+{
+	VL53L1_Error Status = VL53L1_ERROR_NONE;
+
+	if ((pBlob == NULL) || (BlobSize < VL53L1_CALIBRATION_BLOB_SIZE))
+		Status = VL53L1_ERROR_CALIBRATION_BLOB_INVALID;
+	else if ((VL53L1_i2c_decode_uint32_t(4,
+			pBlob + CALBLOB_MAGIC_OFFSET) !=
+			VL53L1_CALIBRATION_BLOB_MAGIC) ||
+		(VL53L1_i2c_decode_uint32_t(4,
+			pBlob + CALBLOB_VERSION_OFFSET) !=
+			VL53L1_CALIBRATION_DATA_STRUCT_VERSION) ||
+		(VL53L1_i2c_decode_uint16_t(2,
+			pBlob + CALBLOB_SIZE_OFFSET) !=
+			sizeof(VL53L1_CalibrationData_t)))
+		Status = VL53L1_ERROR_CALIBRATION_BLOB_INVALID;
+	else if (VL53L1_i2c_decode_uint32_t(4, pBlob + CALBLOB_CRC_OFFSET) !=
+		CalibrationBlobCrc(pBlob, VL53L1_CALIBRATION_BLOB_SIZE))
+		Status = VL53L1_ERROR_CALIBRATION_BLOB_INVALID;
+
+	return Status;
+}
+
+VL53L1_Error VL53L1_GetCalibrationBlob(VL53L1_DEV Dev,
+		uint8_t *pBlob, uint32_t BlobSize)
+{
+	VL53L1_Error Status = VL53L1_ERROR_NONE;
+	VL53L1_CalibrationData_t CalibrationData;
+	uint8_t XTalkCompensationEnable = 0;
+	uint8_t Flags = 0;
+
+	LOG_FUNCTION_START("");
+
+	if (BlobSize < VL53L1_CALIBRATION_BLOB_SIZE)
+		Status = VL53L1_ERROR_BUFFER_TOO_SMALL;
+
+	/* padding is zeroed so that the same calibration gives the same
+	 * blob, and the same CRC
+	 */
+	memset(&CalibrationData, 0, sizeof(VL53L1_CalibrationData_t));
+
+	if (Status == VL53L1_ERROR_NONE)
+		Status = VL53L1_GetCalibrationData(Dev, &CalibrationData);
+
+	if (Status == VL53L1_ERROR_NONE)
+		Status = VL53L1_GetXTalkCompensationEnable(Dev,
+			&XTalkCompensationEnable);
+
+	if (Status == VL53L1_ERROR_NONE) {
+		if (XTalkCompensationEnable != 0)
+			Flags |= VL53L1_CALIBRATION_BLOB_FLAG_XTALK_COMP;
+
+		VL53L1_i2c_encode_uint32_t(VL53L1_CALIBRATION_BLOB_MAGIC, 4,
+			pBlob + CALBLOB_MAGIC_OFFSET);
+		VL53L1_i2c_encode_uint32_t(CalibrationData.struct_version, 4,
+			pBlob + CALBLOB_VERSION_OFFSET);
+		VL53L1_i2c_encode_uint16_t(sizeof(VL53L1_CalibrationData_t), 2,
+			pBlob + CALBLOB_SIZE_OFFSET);
+		pBlob[CALBLOB_FLAGS_OFFSET] = Flags;
+		pBlob[CALBLOB_FLAGS_OFFSET + 1] = 0;
+
+		/* memcpy(DEST, SRC, N)  */
+		memcpy(pBlob + VL53L1_CALIBRATION_BLOB_HEADER_SIZE,
+			&CalibrationData, sizeof(VL53L1_CalibrationData_t));
+
+		VL53L1_i2c_encode_uint32_t(
+			CalibrationBlobCrc(pBlob, VL53L1_CALIBRATION_BLOB_SIZE),
+			4, pBlob + CALBLOB_CRC_OFFSET);
+	}
+
+	LOG_FUNCTION_END(Status);
+	return Status;
+}
+
+VL53L1_Error VL53L1_SetCalibrationBlob(VL53L1_DEV Dev,
+		uint8_t *pBlob, uint32_t BlobSize)
+{
+	VL53L1_Error Status = VL53L1_ERROR_NONE;
+	VL53L1_CalibrationData_t CalibrationData;
+
+	LOG_FUNCTION_START("");
+
+	Status = CheckCalibrationBlob(pBlob, BlobSize);
+
+	if (Status == VL53L1_ERROR_NONE) {
+		/* memcpy(DEST, SRC, N)  */
+		memcpy(&CalibrationData,
+			pBlob + VL53L1_CALIBRATION_BLOB_HEADER_SIZE,
+			sizeof(VL53L1_CalibrationData_t));
+		Status = VL53L1_SetCalibrationData(Dev, &CalibrationData);
+	}
+
+	if (Status == VL53L1_ERROR_NONE)
+		Status = VL53L1_SetXTalkCompensationEnable(Dev,
+			pBlob[CALBLOB_FLAGS_OFFSET] &
+			VL53L1_CALIBRATION_BLOB_FLAG_XTALK_COMP);
+
+	LOG_FUNCTION_END(Status);
+	return Status;
+}
+
+VL53L1_Error VL53L1_DataInitWithCalibrationBlob(VL53L1_DEV Dev,
+		uint8_t *pBlob, uint32_t BlobSize)
+{
+	VL53L1_Error Status = VL53L1_ERROR_NONE;
+
+	LOG_FUNCTION_START("");
+
+	Status = VL53L1_DataInit(Dev);
+
+	if (Status == VL53L1_ERROR_NONE)
+		Status = VL53L1_StaticInit(Dev);
+
+	if (Status == VL53L1_ERROR_NONE)
+		Status = VL53L1_SetCalibrationBlob(Dev, pBlob, BlobSize);
+
+	LOG_FUNCTION_END(Status);
+	return Status;
+}
+
+
+
 VL53L1_Error VL53L1_GetOpticalCenter(VL53L1_DEV Dev,
 		FixPoint1616_t *pOpticalCenterX,
 		FixPoint1616_t *pOpticalCenterY)
@@ -2820,7 +3191,7 @@ static VL53L1_Error VL53L1_LoadPatch(VL53L1_DEV Dev)
 	if (status == VL53L1_ERROR_NONE)
 		VL53L1_enable_powerforce(Dev);
 
-	patch_tuning = BDTable[VL53L1_TUNING_PHASECAL_PATCH_POWER];
+	patch_tuning = BDTABLE(Dev)[VL53L1_TUNING_PHASECAL_PATCH_POWER];
 
 	switch(patch_tuning) {
 	case 0:
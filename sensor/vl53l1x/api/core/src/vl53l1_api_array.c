@@ -0,0 +1,220 @@
+// SPDX-License-Identifier: GPL-2.0+ OR BSD-3-Clause
+/******************************************************************************
+ This file is part of VL53L1 and is dual licensed,
+ either GPL-2.0+
+ or 'BSD 3-clause "New" or "Revised" License' , at your option.
+ ******************************************************************************
+ */
+
+/**
+ * @file  vl53l1_api_array.c
+ *
+ * @brief Multi-device (sensor array) management on a shared I2C bus
+ */
+
+#include "vl53l1_api_array.h"
+
+#define LOG_FUNCTION_START(fmt, ...) \
+	_LOG_FUNCTION_START(VL53L1_TRACE_MODULE_API, fmt, ##__VA_ARGS__)
+#define LOG_FUNCTION_END(status, ...) \
+	_LOG_FUNCTION_END(VL53L1_TRACE_MODULE_API, status, ##__VA_ARGS__)
+#define LOG_FUNCTION_END_FMT(status, fmt, ...) \
+	_LOG_FUNCTION_END_FMT(VL53L1_TRACE_MODULE_API, status, \
+			fmt, ##__VA_ARGS__)
+
+/* same guard as VL53L1_StartMeasurement() in timed mode */
+#define ARRAY_TIMING_GUARD_MILLISECONDS 4
+
+
+static VL53L1_Error ArrayBootAndAddress(VL53L1_Array_t *pArray)
+{
+	VL53L1_Error Status = VL53L1_ERROR_NONE;
+	uint8_t i;
+
+	/* hold every device in reset so that only the one being
+	 * readdressed answers on the default address
+	 */
+	if (pArray->XShut != NULL) {
+		for (i = 0; (i < pArray->NumberOfDevices) &&
+			(Status == VL53L1_ERROR_NONE); i++)
+			Status = pArray->XShut(pArray->pCtx, i, 0);
+	}
+
+	for (i = 0; (i < pArray->NumberOfDevices) &&
+		(Status == VL53L1_ERROR_NONE); i++) {
+		if (pArray->XShut != NULL) {
+			Status = pArray->XShut(pArray->pCtx, i, 1);
+			if ((Status == VL53L1_ERROR_NONE) &&
+				(pArray->SetAddress != NULL))
+				Status = pArray->SetAddress(pArray->pCtx, i,
+					VL53L1_ARRAY_DEFAULT_ADDRESS);
+		}
+
+		if (Status == VL53L1_ERROR_NONE)
+			Status = VL53L1_WaitDeviceBooted(pArray->Dev[i]);
+
+		if ((Status == VL53L1_ERROR_NONE) &&
+			(pArray->XShut != NULL) &&
+			(pArray->DeviceAddress[i] !=
+			VL53L1_ARRAY_DEFAULT_ADDRESS)) {
+			Status = VL53L1_SetDeviceAddress(pArray->Dev[i],
+				pArray->DeviceAddress[i]);
+			if ((Status == VL53L1_ERROR_NONE) &&
+				(pArray->SetAddress != NULL))
+				Status = pArray->SetAddress(pArray->pCtx, i,
+					pArray->DeviceAddress[i]);
+		}
+	}
+
+	return Status;
+}
+
+
+VL53L1_Error VL53L1_ArrayInit(VL53L1_Array_t *pArray)
+{
+	VL53L1_Error Status = VL53L1_ERROR_NONE;
+	uint8_t i;
+	uint8_t j;
+
+	LOG_FUNCTION_START("");
+
+	if ((pArray->NumberOfDevices == 0) ||
+		(pArray->NumberOfDevices > VL53L1_ARRAY_MAX_DEVICES))
+		Status = VL53L1_ERROR_INVALID_PARAMS;
+
+	if (pArray->InterMeasurementPeriodMilliSeconds <
+		pArray->TimingBudgetMicroSeconds / 1000 +
+		ARRAY_TIMING_GUARD_MILLISECONDS)
+		Status = VL53L1_ERROR_INVALID_PARAMS;
+
+	/* two devices left on the same address can not be told apart */
+	for (i = 0; (i < pArray->NumberOfDevices) &&
+		(Status == VL53L1_ERROR_NONE); i++)
+		for (j = i + 1; j < pArray->NumberOfDevices; j++)
+			if (pArray->DeviceAddress[i] ==
+				pArray->DeviceAddress[j])
+				Status = VL53L1_ERROR_INVALID_PARAMS;
+
+	/* devices are released from XSHUTDOWN in index order, the one
+	 * keeping the default address must be the last, or the next one
+	 * released would boot on the same address
+	 */
+	if ((Status == VL53L1_ERROR_NONE) && (pArray->XShut != NULL))
+		for (i = 0; i + 1 < pArray->NumberOfDevices; i++)
+			if (pArray->DeviceAddress[i] ==
+				VL53L1_ARRAY_DEFAULT_ADDRESS)
+				Status = VL53L1_ERROR_INVALID_PARAMS;
+
+	/* Phase 1: serial by nature, one device at a time on 0x52 */
+	if (Status == VL53L1_ERROR_NONE)
+		Status = ArrayBootAndAddress(pArray);
+
+	/* Phase 2 to 4: every device is on its own address, each phase is
+	 * run over the whole array before the next one starts
+	 */
+	for (i = 0; (i < pArray->NumberOfDevices) &&
+		(Status == VL53L1_ERROR_NONE); i++)
+		Status = VL53L1_DataInit(pArray->Dev[i]);
+
+	for (i = 0; (i < pArray->NumberOfDevices) &&
+		(Status == VL53L1_ERROR_NONE); i++)
+		Status = VL53L1_StaticInit(pArray->Dev[i]);
+
+	for (i = 0; (i < pArray->NumberOfDevices) &&
+		(Status == VL53L1_ERROR_NONE); i++) {
+		Status = VL53L1_SetMeasurementTimingBudgetMicroSeconds(
+			pArray->Dev[i], pArray->TimingBudgetMicroSeconds);
+		if (Status == VL53L1_ERROR_NONE)
+			Status = VL53L1_SetInterMeasurementPeriodMilliSeconds(
+				pArray->Dev[i],
+				pArray->InterMeasurementPeriodMilliSeconds);
+	}
+
+	pArray->FrameCount = 0;
+
+	LOG_FUNCTION_END(Status);
+	return Status;
+}
+
+
+VL53L1_Error VL53L1_ArrayStart(VL53L1_Array_t *pArray)
+{
+	VL53L1_Error Status = VL53L1_ERROR_NONE;
+	uint8_t i;
+
+	LOG_FUNCTION_START("");
+
+	for (i = 0; (i < pArray->NumberOfDevices) &&
+		(Status == VL53L1_ERROR_NONE); i++) {
+		if ((i > 0) && (pArray->StaggerMicroSeconds > 0))
+			Status = VL53L1_WaitUs(pArray->Dev[i],
+				(int32_t)pArray->StaggerMicroSeconds);
+		if (Status == VL53L1_ERROR_NONE)
+			Status = VL53L1_StartMeasurement(pArray->Dev[i]);
+	}
+
+	pArray->FrameCount = 0;
+
+	LOG_FUNCTION_END(Status);
+	return Status;
+}
+
+
+VL53L1_Error VL53L1_ArrayGetFrame(VL53L1_Array_t *pArray,
+	VL53L1_ArrayFrame_t *pFrame)
+{
+	VL53L1_Error Status = VL53L1_ERROR_NONE;
+	VL53L1_Error lStatus;
+	VL53L1_RangingMeasurementData_t RMData;
+	uint8_t i;
+
+	LOG_FUNCTION_START("");
+
+	pFrame->ValidMask = 0;
+
+	for (i = 0; i < pArray->NumberOfDevices; i++) {
+		lStatus = VL53L1_WaitMeasurementDataReady(pArray->Dev[i]);
+		if (lStatus == VL53L1_ERROR_NONE)
+			lStatus = VL53L1_GetRangingMeasurementData(
+				pArray->Dev[i], &RMData);
+		if (lStatus == VL53L1_ERROR_NONE)
+			lStatus = VL53L1_ClearInterruptAndStartMeasurement(
+				pArray->Dev[i]);
+
+		if (lStatus == VL53L1_ERROR_NONE) {
+			pFrame->RangeMilliMeter[i] = RMData.RangeMilliMeter;
+			pFrame->RangeStatus[i] = RMData.RangeStatus;
+			pFrame->ValidMask |= (uint8_t)(1 << i);
+		} else {
+			pFrame->RangeMilliMeter[i] = 0;
+			pFrame->RangeStatus[i] = VL53L1_RANGESTATUS_NONE;
+			if (Status == VL53L1_ERROR_NONE)
+				Status = lStatus;
+		}
+	}
+
+	pFrame->FrameCount = pArray->FrameCount++;
+
+	LOG_FUNCTION_END(Status);
+	return Status;
+}
+
+
+VL53L1_Error VL53L1_ArrayStop(VL53L1_Array_t *pArray)
+{
+	VL53L1_Error Status = VL53L1_ERROR_NONE;
+	VL53L1_Error lStatus;
+	uint8_t i;
+
+	LOG_FUNCTION_START("");
+
+	/* stop every device even if one of them fails */
+	for (i = 0; i < pArray->NumberOfDevices; i++) {
+		lStatus = VL53L1_StopMeasurement(pArray->Dev[i]);
+		if (Status == VL53L1_ERROR_NONE)
+			Status = lStatus;
+	}
+
+	LOG_FUNCTION_END(Status);
+	return Status;
+}
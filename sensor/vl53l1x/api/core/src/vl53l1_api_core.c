@@ -99,6 +99,25 @@
 
 #define VL53L1_MAX_I2C_XFER_SIZE 256
 
+/* RESULT__INTERRUPT_STATUS up to RESULT__AVG_SIGNAL_COUNT_RATE_MCPS_SD0 */
+#define VL53L1_SIMPLE_RESULTS_I2C_SIZE_BYTES \
+	(VL53L1_RESULT__AVG_SIGNAL_COUNT_RATE_MCPS_SD0 + 2 - \
+	VL53L1_SYSTEM_RESULTS_I2C_INDEX)
+
+/* configuration register groups held in VL53L1_cfg_image_t, in register
+ * order, closed by the first group that is always written
+ */
+#define VL53L1_CFG_IMAGE_GROUPS 5
+
+static const uint16_t cfg_image_group_i2c_index[VL53L1_CFG_IMAGE_GROUPS + 1] = {
+	VL53L1_STATIC_NVM_MANAGED_I2C_INDEX,
+	VL53L1_CUSTOMER_NVM_MANAGED_I2C_INDEX,
+	VL53L1_STATIC_CONFIG_I2C_INDEX,
+	VL53L1_GENERAL_CONFIG_I2C_INDEX,
+	VL53L1_TIMING_CONFIG_I2C_INDEX,
+	VL53L1_DYNAMIC_CONFIG_I2C_INDEX
+};
+
 #ifdef VL53L1_DEBUG
 VL53L1_Error VL53L1_get_version(
 	VL53L1_DEV           Dev,
@@ -181,6 +200,15 @@ VL53L1_Error VL53L1_data_init(
 	pdev->dss_config__target_total_rate_mcps = 0x0A00;
 	pdev->debug_mode                  =  0x00;
 
+	/* range completion is polled until a platform hook is installed */
+
+	pdev->irq_hook.wait_func          = NULL;
+	pdev->irq_hook.pctx               = NULL;
+
+	/* the device configuration is unknown until fully written */
+
+	VL53L1_invalidate_cfg_image(Dev);
+
 	/* initialise gain calibration values to tuning parameter values */
 
 	pdev->gain_cal.standard_ranging_gain_factor =
@@ -415,6 +443,10 @@ VL53L1_Error VL53L1_software_reset(
 
 	LOG_FUNCTION_START("");
 
+	/* the device comes back with its NVM configuration */
+
+	VL53L1_invalidate_cfg_image(Dev);
+
 	/* apply reset - note despite the name soft reset is active low! */
 	if (status == VL53L1_ERROR_NONE) /*lint !e774 always true*/
 		status = VL53L1_WrByte(
@@ -1923,6 +1955,7 @@ VL53L1_Error VL53L1_init_and_start_range(
 	uint16_t i2c_index                  = 0;
 	uint16_t i2c_buffer_offset_bytes    = 0;
 	uint16_t i2c_buffer_size_bytes      = 0;
+	uint16_t i2c_write_index            = 0;
 
 	LOG_FUNCTION_START("");
 
@@ -2130,15 +2163,62 @@ VL53L1_Error VL53L1_init_and_start_range(
 				&buffer[i2c_buffer_offset_bytes]);
 	}
 
+	/*
+	 * Leave out the leading configuration groups the device already
+	 * holds e.g. on a stop / start cycle with unchanged settings
+	 */
+
+	i2c_write_index = i2c_index;
+
+	if (pdev->cfg_image.valid_from_index <= i2c_index) {
+		for (i = 0 ; i < VL53L1_CFG_IMAGE_GROUPS ; i++) {
+			if (cfg_image_group_i2c_index[i] != i2c_write_index)
+				continue;
+
+			if (memcmp(
+				&buffer[i2c_write_index - i2c_index],
+				&(pdev->cfg_image.buffer[i2c_write_index -
+					VL53L1_STATIC_NVM_MANAGED_I2C_INDEX]),
+				cfg_image_group_i2c_index[i+1] -
+					i2c_write_index) != 0)
+				break;
+
+			i2c_write_index = cfg_image_group_i2c_index[i+1];
+		}
+	}
+
 	/* Send I2C Buffer */
 
 	if (status == VL53L1_ERROR_NONE) {
 		status =
 			VL53L1_WriteMulti(
 				Dev,
-				i2c_index,
-				buffer,
-				(uint32_t)i2c_buffer_size_bytes);
+				i2c_write_index,
+				&buffer[i2c_write_index - i2c_index],
+				(uint32_t)(i2c_buffer_size_bytes -
+					(i2c_write_index - i2c_index)));
+	}
+
+	/*
+	 * Update the configuration image with the groups written
+	 */
+
+	if (status == VL53L1_ERROR_NONE) {
+		if (i2c_write_index < VL53L1_DYNAMIC_CONFIG_I2C_INDEX) {
+			memcpy(
+				&(pdev->cfg_image.buffer[i2c_write_index -
+					VL53L1_STATIC_NVM_MANAGED_I2C_INDEX]),
+				&buffer[i2c_write_index - i2c_index],
+				VL53L1_DYNAMIC_CONFIG_I2C_INDEX -
+					i2c_write_index);
+
+			if (i2c_write_index <
+				pdev->cfg_image.valid_from_index)
+				pdev->cfg_image.valid_from_index =
+					i2c_write_index;
+		}
+	} else {
+		VL53L1_invalidate_cfg_image(Dev);
 	}
 
 	/*
@@ -2235,6 +2315,10 @@ VL53L1_Error VL53L1_get_measurement_results(
 				VL53L1_CORE_RESULTS_I2C_SIZE_BYTES) -
 				i2c_index;
 		break;
+	case VL53L1_DEVICERESULTSLEVEL_SIMPLE:
+		i2c_buffer_size_bytes =
+				VL53L1_SIMPLE_RESULTS_I2C_SIZE_BYTES;
+		break;
 	default:
 		i2c_buffer_size_bytes =
 				VL53L1_SYSTEM_RESULTS_I2C_SIZE_BYTES;
@@ -2279,6 +2363,16 @@ VL53L1_Error VL53L1_get_measurement_results(
 				pcore_results);
 	}
 
+	/* sd1 results are not read at simple level: decode them as zero */
+
+	if (device_results_level == VL53L1_DEVICERESULTSLEVEL_SIMPLE &&
+		status == VL53L1_ERROR_NONE)
+		memset(
+			&buffer[i2c_buffer_size_bytes],
+			0,
+			VL53L1_SYSTEM_RESULTS_I2C_SIZE_BYTES -
+			i2c_buffer_size_bytes);
+
 	if (status == VL53L1_ERROR_NONE) {
 
 		i2c_buffer_offset_bytes = 0;
@@ -2321,6 +2415,12 @@ VL53L1_Error VL53L1_get_device_results(
 
 	LOG_FUNCTION_START("");
 
+	/* first range of low power auto needs the debug results */
+
+	if ((pdev->low_power_auto_data.is_low_power_auto_mode == 1) &&
+		(pdev->low_power_auto_data.low_power_auto_range_count == 0))
+		device_results_level = VL53L1_DEVICERESULTSLEVEL_FULL;
+
 	/* Get device results */
 
 	if (status == VL53L1_ERROR_NONE) /*lint !e774 always true*/
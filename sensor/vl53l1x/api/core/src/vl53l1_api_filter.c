@@ -0,0 +1,170 @@
+// SPDX-License-Identifier: GPL-2.0+ OR BSD-3-Clause
+/******************************************************************************
+ This file is part of VL53L1 and is dual licensed,
+ either GPL-2.0+
+ or 'BSD 3-clause "New" or "Revised" License' , at your option.
+ ******************************************************************************
+ */
+
+/**
+ * @file  vl53l1_api_filter.c
+ *
+ * @brief Streaming temporal filter for ranging results
+ */
+
+#include "vl53l1_api_filter.h"
+
+#define LOG_FUNCTION_START(fmt, ...) \
+	_LOG_FUNCTION_START(VL53L1_TRACE_MODULE_API, fmt, ##__VA_ARGS__)
+#define LOG_FUNCTION_END(status, ...) \
+	_LOG_FUNCTION_END(VL53L1_TRACE_MODULE_API, status, ##__VA_ARGS__)
+#define LOG_FUNCTION_END_FMT(status, fmt, ...) \
+	_LOG_FUNCTION_END_FMT(VL53L1_TRACE_MODULE_API, status, \
+			fmt, ##__VA_ARGS__)
+
+/* weight = 2^20 / sigma^2 with sigma in 1/16 mm, clipped to 12 bit so the
+ * sum of VL53L1_FILTER_DEPTH weights fits in 32 bit, the weighted sum of
+ * the ranges needs 64 bit past a depth of 16
+ */
+#define FILTER_WEIGHT_MAX     4095
+#define FILTER_SIGMA_MIN_Q4   16    /* 1 mm */
+
+
+static uint16_t FilterWeight(FixPoint1616_t SigmaMilliMeter)
+{
+	uint32_t sigma_q4 = SigmaMilliMeter >> 12;
+	uint32_t weight;
+
+	if (sigma_q4 < FILTER_SIGMA_MIN_Q4)
+		sigma_q4 = FILTER_SIGMA_MIN_Q4;
+
+	/* sigma above 2048 mm: clip before squaring */
+	if (sigma_q4 > 0x7FFF)
+		sigma_q4 = 0x7FFF;
+
+	weight = (1UL << 20) / (sigma_q4 * sigma_q4);
+
+	if (weight > FILTER_WEIGHT_MAX)
+		weight = FILTER_WEIGHT_MAX;
+	else if (weight == 0)
+		weight = 1;
+
+	return (uint16_t)weight;
+}
+
+
+VL53L1_Error VL53L1_RangeFilterInit(VL53L1_RangeFilter_t *pFilter,
+	uint16_t MinGateMilliMeter, uint8_t MaxRejectCount)
+{
+	VL53L1_Error Status = VL53L1_ERROR_NONE;
+
+	LOG_FUNCTION_START("");
+
+	pFilter->Head = 0;
+	pFilter->Count = 0;
+	pFilter->RejectCount = 0;
+	pFilter->MaxRejectCount = MaxRejectCount;
+	pFilter->MinGateMilliMeter = MinGateMilliMeter;
+	pFilter->FilteredMilliMeter = 0;
+
+	LOG_FUNCTION_END(Status);
+	return Status;
+}
+
+
+VL53L1_Error VL53L1_RangeFilterUpdate(VL53L1_RangeFilter_t *pFilter,
+	const VL53L1_RangingMeasurementData_t *pRangeData,
+	VL53L1_FilteredRange_t *pOut)
+{
+	VL53L1_Error Status = VL53L1_ERROR_NONE;
+	int32_t Range = pRangeData->RangeMilliMeter;
+	int32_t Deviation;
+	int32_t Gate;
+	int32_t SumWeight = 0;
+	int64_t SumWeightedRange = 0;
+	uint8_t Accept = 0;
+	uint8_t Slot;
+	uint8_t i;
+
+	LOG_FUNCTION_START("");
+
+	if (pRangeData->RangeStatus == VL53L1_RANGESTATUS_RANGE_VALID) {
+		if (pFilter->Count == 0) {
+			Accept = 1;
+		} else {
+			Deviation = Range - pFilter->FilteredMilliMeter;
+			if (Deviation < 0)
+				Deviation = -Deviation;
+
+			Gate = (int32_t)(3 * (pRangeData->SigmaMilliMeter >> 16));
+			if (Gate < (int32_t)pFilter->MinGateMilliMeter)
+				Gate = (int32_t)pFilter->MinGateMilliMeter;
+
+			if (Deviation <= Gate) {
+				Accept = 1;
+			} else if (pFilter->RejectCount >=
+				pFilter->MaxRejectCount) {
+				/* persistent jump: the target changed, restart */
+				pFilter->Count = 0;
+				Accept = 1;
+			} else {
+				pFilter->RejectCount++;
+			}
+		}
+	}
+
+	if (Accept == 1) {
+		pFilter->RejectCount = 0;
+		pFilter->RangeMilliMeter[pFilter->Head] = (int16_t)Range;
+		pFilter->Weight[pFilter->Head] =
+			FilterWeight(pRangeData->SigmaMilliMeter);
+		pFilter->Head = (pFilter->Head + 1) &
+			(VL53L1_FILTER_DEPTH - 1);
+		if (pFilter->Count < VL53L1_FILTER_DEPTH)
+			pFilter->Count++;
+
+		/* the ring is dense from Head backwards, order is irrelevant
+		 * for the mean so sum the Count most recent slots
+		 */
+		for (i = 0; i < pFilter->Count; i++) {
+			Slot = (pFilter->Head - 1 - i) &
+				(VL53L1_FILTER_DEPTH - 1);
+			SumWeight += pFilter->Weight[Slot];
+			SumWeightedRange += (int32_t)pFilter->Weight[Slot] *
+				(int32_t)pFilter->RangeMilliMeter[Slot];
+		}
+
+		if (SumWeightedRange >= 0)
+			SumWeightedRange += SumWeight / 2;
+		else
+			SumWeightedRange -= SumWeight / 2;
+		pFilter->FilteredMilliMeter =
+			(int16_t)(SumWeightedRange / SumWeight);
+	}
+
+	pOut->RangeMilliMeter = pFilter->FilteredMilliMeter;
+	pOut->Valid = (pFilter->Count > 0) ? 1 : 0;
+	pOut->Rejected = (Accept == 1) ? 0 : 1;
+
+	LOG_FUNCTION_END(Status);
+	return Status;
+}
+
+
+VL53L1_Error VL53L1_RangeFilterUpdateArray(VL53L1_RangeFilter_t *pFilter,
+	const VL53L1_RangingMeasurementData_t *pRangeData,
+	VL53L1_FilteredRange_t *pOut, uint8_t NumberOfDevices)
+{
+	VL53L1_Error Status = VL53L1_ERROR_NONE;
+	uint8_t i;
+
+	LOG_FUNCTION_START("");
+
+	for (i = 0; (i < NumberOfDevices) &&
+		(Status == VL53L1_ERROR_NONE); i++)
+		Status = VL53L1_RangeFilterUpdate(&pFilter[i],
+			&pRangeData[i], &pOut[i]);
+
+	LOG_FUNCTION_END(Status);
+	return Status;
+}
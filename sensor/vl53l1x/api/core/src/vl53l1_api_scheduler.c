@@ -0,0 +1,306 @@
+// SPDX-License-Identifier: GPL-2.0+ OR BSD-3-Clause
+/******************************************************************************
+ This file is part of VL53L1 and is dual licensed,
+ either GPL-2.0+
+ or 'BSD 3-clause "New" or "Revised" License' , at your option.
+ ******************************************************************************
+ */
+
+/**
+ * @file  vl53l1_api_scheduler.c
+ *
+ * @brief Adaptive ranging scheduler for the low power autonomous preset
+ */
+
+#include "vl53l1_api_scheduler.h"
+
+#define LOG_FUNCTION_START(fmt, ...) \
+	_LOG_FUNCTION_START(VL53L1_TRACE_MODULE_API, fmt, ##__VA_ARGS__)
+#define LOG_FUNCTION_END(status, ...) \
+	_LOG_FUNCTION_END(VL53L1_TRACE_MODULE_API, status, ##__VA_ARGS__)
+#define LOG_FUNCTION_END_FMT(status, fmt, ...) \
+	_LOG_FUNCTION_END_FMT(VL53L1_TRACE_MODULE_API, status, \
+			fmt, ##__VA_ARGS__)
+
+/* same guard as VL53L1_StartMeasurement() in timed mode */
+#define SCHED_TIMING_GUARD_MILLISECONDS 4
+
+/* sigma ratio limits per timing budget step, budget moves by 4x at most */
+#define SCHED_SIGMA_RATIO_MIN_Q8 128
+#define SCHED_SIGMA_RATIO_MAX_Q8 512
+
+
+static uint32_t SchedulerMinPeriod(uint32_t TimingBudgetMicroSeconds)
+{
+	return TimingBudgetMicroSeconds / 1000 +
+		SCHED_TIMING_GUARD_MILLISECONDS;
+}
+
+
+static VL53L1_Error SchedulerApply(VL53L1_DEV Dev,
+	VL53L1_Scheduler_t *pSched)
+{
+	VL53L1_Error Status = VL53L1_ERROR_NONE;
+	VL53L1_DetectionConfig_t Config;
+	int32_t Low;
+	int32_t High;
+
+	if (pSched->InterMeasurementPeriodMilliSeconds <
+		SchedulerMinPeriod(pSched->TimingBudgetMicroSeconds))
+		pSched->InterMeasurementPeriodMilliSeconds =
+			SchedulerMinPeriod(pSched->TimingBudgetMicroSeconds);
+
+	Status = VL53L1_SetMeasurementTimingBudgetMicroSeconds(Dev,
+		pSched->TimingBudgetMicroSeconds);
+
+	if (Status == VL53L1_ERROR_NONE)
+		Status = VL53L1_SetInterMeasurementPeriodMilliSeconds(Dev,
+			pSched->InterMeasurementPeriodMilliSeconds);
+
+	memset(&Config, 0, sizeof(Config));
+	Config.DetectionMode = VL53L1_DETECTION_NORMAL_RUN;
+
+	if (pSched->MotionWindowArmed == 1) {
+		Low = pSched->LastRangeMilliMeter -
+			pSched->StableRangeMilliMeter;
+		High = pSched->LastRangeMilliMeter +
+			pSched->StableRangeMilliMeter;
+		if (Low < 0)
+			Low = 0;
+		if (High > 0xFFFF)
+			High = 0xFFFF;
+
+		Config.DetectionMode = VL53L1_DETECTION_DISTANCE_ONLY;
+		Config.IntrNoTarget = 1;
+		Config.Distance.CrossMode = VL53L1_THRESHOLD_OUT_OF_WINDOW;
+		Config.Distance.Low = (uint16_t)Low;
+		Config.Distance.High = (uint16_t)High;
+	}
+
+	if (Status == VL53L1_ERROR_NONE)
+		Status = VL53L1_SetThresholdConfig(Dev, &Config);
+
+	return Status;
+}
+
+
+static uint32_t SchedulerTuneBudget(VL53L1_Scheduler_t *pSched)
+{
+	uint32_t Budget = pSched->TimingBudgetMicroSeconds;
+	uint32_t Ratio;
+	uint32_t Sigma = pSched->SigmaMilliMeter >> 8;
+	uint32_t Target = pSched->TargetSigmaMilliMeter >> 8;
+
+	if (Target == 0)
+		return Budget;
+
+	/* within 1/8 of the target: leave the budget alone */
+	if ((Sigma * 8 >= Target * 7) && (Sigma * 8 <= Target * 9))
+		return Budget;
+
+	/* sigma goes as 1 / sqrt(budget), so budget scales as ratio^2 */
+	Ratio = (Sigma << 8) / Target;
+	if (Ratio < SCHED_SIGMA_RATIO_MIN_Q8)
+		Ratio = SCHED_SIGMA_RATIO_MIN_Q8;
+	if (Ratio > SCHED_SIGMA_RATIO_MAX_Q8)
+		Ratio = SCHED_SIGMA_RATIO_MAX_Q8;
+
+	Budget = (((Budget >> 8) * Ratio) >> 4) * Ratio >> 4;
+
+	if (Budget < pSched->MinTimingBudgetMicroSeconds)
+		Budget = pSched->MinTimingBudgetMicroSeconds;
+	if (Budget > pSched->MaxTimingBudgetMicroSeconds)
+		Budget = pSched->MaxTimingBudgetMicroSeconds;
+
+	return Budget;
+}
+
+
+VL53L1_Error VL53L1_SchedulerInit(VL53L1_DEV Dev,
+	VL53L1_Scheduler_t *pSched)
+{
+	VL53L1_Error Status = VL53L1_ERROR_NONE;
+
+	LOG_FUNCTION_START("");
+
+	if ((pSched->MinInterMeasurementPeriodMilliSeconds >
+		pSched->MaxInterMeasurementPeriodMilliSeconds) ||
+		(pSched->MinTimingBudgetMicroSeconds >
+		pSched->MaxTimingBudgetMicroSeconds) ||
+		(pSched->MaxInterMeasurementPeriodMilliSeconds <
+		SchedulerMinPeriod(pSched->MaxTimingBudgetMicroSeconds)) ||
+		(pSched->MinInterMeasurementPeriodMilliSeconds <
+		SchedulerMinPeriod(pSched->MinTimingBudgetMicroSeconds)) ||
+		(pSched->StableCount == 0))
+		Status = VL53L1_ERROR_INVALID_PARAMS;
+
+	if (Status == VL53L1_ERROR_NONE)
+		Status = VL53L1_SetPresetMode(Dev,
+			VL53L1_PRESETMODE_LOWPOWER_AUTONOMOUS);
+
+	pSched->InterMeasurementPeriodMilliSeconds =
+		pSched->MinInterMeasurementPeriodMilliSeconds;
+	pSched->TimingBudgetMicroSeconds =
+		pSched->MaxTimingBudgetMicroSeconds;
+	pSched->SigmaMilliMeter = pSched->TargetSigmaMilliMeter;
+	pSched->LastRangeMilliMeter = 0;
+	pSched->LastRangeStatus = VL53L1_RANGESTATUS_NONE;
+	pSched->StableRuns = 0;
+	pSched->SigmaSamples = 0;
+	pSched->MotionWindowArmed = 0;
+	pSched->ReconfigureCount = 0;
+
+	if (Status == VL53L1_ERROR_NONE)
+		Status = SchedulerApply(Dev, pSched);
+
+	LOG_FUNCTION_END(Status);
+	return Status;
+}
+
+
+VL53L1_Error VL53L1_SchedulerStart(VL53L1_DEV Dev,
+	VL53L1_Scheduler_t *pSched)
+{
+	VL53L1_Error Status = VL53L1_ERROR_NONE;
+
+	LOG_FUNCTION_START("");
+
+	pSched->LastRangeStatus = VL53L1_RANGESTATUS_NONE;
+	pSched->StableRuns = 0;
+
+	Status = VL53L1_StartMeasurement(Dev);
+
+	LOG_FUNCTION_END(Status);
+	return Status;
+}
+
+
+VL53L1_Error VL53L1_SchedulerUpdate(VL53L1_DEV Dev,
+	VL53L1_Scheduler_t *pSched,
+	VL53L1_RangingMeasurementData_t *pRangeData)
+{
+	VL53L1_Error Status = VL53L1_ERROR_NONE;
+	uint32_t Period = pSched->InterMeasurementPeriodMilliSeconds;
+	uint32_t MaxPeriod = pSched->MaxInterMeasurementPeriodMilliSeconds;
+	uint32_t Budget = pSched->TimingBudgetMicroSeconds;
+	uint8_t Armed = pSched->MotionWindowArmed;
+	uint8_t Valid;
+	uint8_t LastValid;
+	uint8_t Motion = 0;
+	int32_t Delta;
+	int32_t Sigma;
+
+	LOG_FUNCTION_START("");
+
+	Valid = (pRangeData->RangeStatus == VL53L1_RANGESTATUS_RANGE_VALID);
+	LastValid = (pSched->LastRangeStatus ==
+		VL53L1_RANGESTATUS_RANGE_VALID);
+
+	/* the same rule as the armed window, which only interrupts on out of
+	 * window ranges, but the first range after a start is always reported
+	 */
+	if (pSched->LastRangeStatus != VL53L1_RANGESTATUS_NONE) {
+		if (Valid != LastValid) {
+			/* target appeared or disappeared */
+			Motion = 1;
+		} else if (Valid == 1) {
+			Delta = pRangeData->RangeMilliMeter -
+				pSched->LastRangeMilliMeter;
+			if (Delta < 0)
+				Delta = -Delta;
+			if (Delta > pSched->StableRangeMilliMeter)
+				Motion = 1;
+		}
+	}
+
+	pSched->LastRangeStatus = pRangeData->RangeStatus;
+
+	if (Motion == 1) {
+		Period = pSched->MinInterMeasurementPeriodMilliSeconds;
+		pSched->StableRuns = 0;
+		Armed = 0;
+	} else {
+		pSched->StableRuns++;
+		if ((pSched->StableRuns >= pSched->StableCount) &&
+			(Period < MaxPeriod)) {
+			Period *= 2;
+			if (Period > MaxPeriod)
+				Period = MaxPeriod;
+			pSched->StableRuns = 0;
+		}
+	}
+
+	if (Valid == 1) {
+		pSched->LastRangeMilliMeter = pRangeData->RangeMilliMeter;
+
+		/* running average, 1/4 weight for the new sigma */
+		Sigma = (int32_t)pRangeData->SigmaMilliMeter -
+			(int32_t)pSched->SigmaMilliMeter;
+		pSched->SigmaMilliMeter = (FixPoint1616_t)
+			((int32_t)pSched->SigmaMilliMeter + Sigma / 4);
+		if (pSched->SigmaSamples < 0xFF)
+			pSched->SigmaSamples++;
+
+		if (pSched->SigmaSamples >= pSched->StableCount)
+			Budget = SchedulerTuneBudget(pSched);
+
+		/* the window is only armed at the longest period, centred on
+		 * the current range
+		 */
+		if ((Motion == 0) && (Period == MaxPeriod))
+			Armed = 1;
+	}
+
+	/* what SchedulerApply() would raise it to anyway */
+	if (Period < SchedulerMinPeriod(Budget))
+		Period = SchedulerMinPeriod(Budget);
+
+	if ((Period != pSched->InterMeasurementPeriodMilliSeconds) ||
+		(Budget != pSched->TimingBudgetMicroSeconds) ||
+		(Armed != pSched->MotionWindowArmed)) {
+
+		if (Budget != pSched->TimingBudgetMicroSeconds) {
+			pSched->SigmaMilliMeter = pSched->TargetSigmaMilliMeter;
+			pSched->SigmaSamples = 0;
+		}
+
+		pSched->InterMeasurementPeriodMilliSeconds = Period;
+		pSched->TimingBudgetMicroSeconds = Budget;
+		pSched->MotionWindowArmed = Armed;
+		pSched->ReconfigureCount++;
+
+		Status = VL53L1_StopMeasurement(Dev);
+		if (Status == VL53L1_ERROR_NONE)
+			Status = SchedulerApply(Dev, pSched);
+		if (Status == VL53L1_ERROR_NONE)
+			Status = VL53L1_StartMeasurement(Dev);
+	} else {
+		Status = VL53L1_ClearInterruptAndStartMeasurement(Dev);
+	}
+
+	LOG_FUNCTION_END(Status);
+	return Status;
+}
+
+
+VL53L1_Error VL53L1_SchedulerStop(VL53L1_DEV Dev,
+	VL53L1_Scheduler_t *pSched)
+{
+	VL53L1_Error Status = VL53L1_ERROR_NONE;
+	VL53L1_DetectionConfig_t Config;
+
+	LOG_FUNCTION_START("");
+
+	Status = VL53L1_StopMeasurement(Dev);
+
+	if (pSched->MotionWindowArmed == 1) {
+		pSched->MotionWindowArmed = 0;
+		memset(&Config, 0, sizeof(Config));
+		Config.DetectionMode = VL53L1_DETECTION_NORMAL_RUN;
+		if (Status == VL53L1_ERROR_NONE)
+			Status = VL53L1_SetThresholdConfig(Dev, &Config);
+	}
+
+	LOG_FUNCTION_END(Status);
+	return Status;
+}
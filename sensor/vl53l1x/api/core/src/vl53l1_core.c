@@ -346,6 +346,20 @@ VL53L1_Error VL53L1_check_ll_driver_rd_state(
 }
 
 
+void VL53L1_invalidate_cfg_image(
+	VL53L1_DEV         Dev)
+{
+	/*
+	 * Nothing is known about the configuration registers of the
+	 * device, the next range start sends them all
+	 */
+
+	VL53L1_LLDriverData_t *pdev = VL53L1DevStructGetLLDriverHandle(Dev);
+
+	pdev->cfg_image.valid_from_index = VL53L1_DYNAMIC_CONFIG_I2C_INDEX;
+}
+
+
 VL53L1_Error  VL53L1_update_ll_driver_cfg_state(
 	VL53L1_DEV         Dev)
 {
@@ -1840,6 +1854,9 @@ VL53L1_Error VL53L1_set_ref_spad_char_config(
 
 	LOG_FUNCTION_START("");
 
+	/* registers below are written outside of the configuration image */
+	VL53L1_invalidate_cfg_image(Dev);
+
 	/*
 	 * Update Macro Period for Range A VCSEL Period
 	 */
@@ -1953,6 +1970,9 @@ VL53L1_Error VL53L1_set_ssc_config(
 
 	LOG_FUNCTION_START("");
 
+	/* registers below are written outside of the configuration image */
+	VL53L1_invalidate_cfg_image(Dev);
+
 	/*
 	 * Update Macro Period for Range A VCSEL Period
 	 */
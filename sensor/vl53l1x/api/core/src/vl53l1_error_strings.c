@@ -291,6 +291,10 @@ VL53L1_Error VL53L1_get_pal_error_string(
 		VL53L1_COPYSTRING(pPalErrorString,
 			VL53L1_STRING_ERROR_NOT_IMPLEMENTED);
 		break;
+	case VL53L1_ERROR_CALIBRATION_BLOB_INVALID:
+		VL53L1_COPYSTRING(pPalErrorString,
+			VL53L1_STRING_ERROR_CALIBRATION_BLOB_INVALID);
+		break;
 	default:
 		VL53L1_COPYSTRING(pPalErrorString,
 				VL53L1_STRING_UNKNOW_ERROR_CODE);
@@ -217,7 +217,7 @@ VL53L1_Error VL53L1_wait_for_range_completion(
 		/* blocking version */
 
 		status =
-			VL53L1_poll_for_range_completion(
+			VL53L1_wait_for_range_event(
 				Dev,
 				VL53L1_RANGE_COMPLETION_POLLING_TIMEOUT_MS);
 
@@ -264,7 +264,7 @@ VL53L1_Error VL53L1_wait_for_test_completion(
 		/* blocking version */
 
 		status =
-			VL53L1_poll_for_range_completion(
+			VL53L1_wait_for_range_event(
 				Dev,
 				VL53L1_TEST_COMPLETION_POLLING_TIMEOUT_MS);
 
@@ -556,3 +556,88 @@ VL53L1_Error VL53L1_poll_for_range_completion(
 	return status;
 }
 
+
+VL53L1_Error VL53L1_wait_for_range_interrupt(
+	VL53L1_DEV     Dev,
+	uint32_t       timeout_ms)
+{
+	/**
+	 * Blocks on the platform interrupt hook instead of polling
+	 * VL53L1_GPIO__TIO_HV_STATUS. A single register read confirms each
+	 * event so that a stale event (e.g. interrupt already serviced by a
+	 * VL53L1_is_new_data_ready() call) does not end the wait early.
+	 */
+
+	VL53L1_Error status = VL53L1_ERROR_NONE;
+	VL53L1_LLDriverData_t *pdev = VL53L1DevStructGetLLDriverHandle(Dev);
+
+	uint32_t     start_time_ms   = 0;
+	uint32_t     current_time_ms = 0;
+	uint32_t     elapsed_ms      = 0;
+	uint8_t      data_ready      = 0;
+
+	LOG_FUNCTION_START("");
+
+	if (pdev->irq_hook.wait_func == NULL)
+		status = VL53L1_ERROR_NOT_IMPLEMENTED;
+
+	VL53L1_GetTickCount(&start_time_ms); /*lint !e534 ignoring return*/
+
+	while ((status == VL53L1_ERROR_NONE) &&
+		   (elapsed_ms < timeout_ms) &&
+		   (data_ready == 0)) {
+
+		status = pdev->irq_hook.wait_func(
+			pdev->irq_hook.pctx,
+			timeout_ms - elapsed_ms);
+
+		/* a timed out hook may have missed the edge: check anyway */
+
+		if (status == VL53L1_ERROR_TIME_OUT)
+			elapsed_ms = timeout_ms;
+
+		if (status == VL53L1_ERROR_NONE ||
+			status == VL53L1_ERROR_TIME_OUT)
+			status = VL53L1_is_new_data_ready(
+				Dev,
+				&data_ready);
+
+		if (elapsed_ms < timeout_ms) {
+			VL53L1_GetTickCount(&current_time_ms);  /*lint !e534 ignoring return*/
+			elapsed_ms = current_time_ms - start_time_ms;
+		}
+	}
+
+	if (data_ready == 0 && status == VL53L1_ERROR_NONE)
+		status = VL53L1_ERROR_TIME_OUT;
+
+	LOG_FUNCTION_END(status);
+
+	return status;
+}
+
+
+VL53L1_Error VL53L1_wait_for_range_event(
+	VL53L1_DEV     Dev,
+	uint32_t       timeout_ms)
+{
+	/**
+	 * Uses the interrupt hook when installed, polls otherwise.
+	 * The polling path is also taken when the hook reports
+	 * VL53L1_ERROR_NOT_IMPLEMENTED (e.g. GPIO1 not wired).
+	 */
+
+	VL53L1_Error status = VL53L1_ERROR_NONE;
+
+	LOG_FUNCTION_START("");
+
+	status = VL53L1_wait_for_range_interrupt(Dev, timeout_ms);
+
+	if (status == VL53L1_ERROR_NOT_IMPLEMENTED)
+		status = VL53L1_poll_for_range_completion(Dev, timeout_ms);
+
+	LOG_FUNCTION_END(status);
+
+	return status;
+}
+